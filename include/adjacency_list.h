@@ -0,0 +1,109 @@
+/*
+* Filename: adjacency_list.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef ADJACENCY_LIST_H_
+#define ADJACENCY_LIST_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <new>
+
+#include "arc.h"
+#include "arena.h"
+
+namespace geom
+{
+    /**
+     * @brief Growable list of the arcs leaving a vertex, with the same interface as Vector.
+     *        Each arc carries the neighbor and the weights, so scanning the list does not
+     *        touch the edges
+     *
+     * When an arena is set, the storage comes from it, so no malloc or free is made. Growing
+     * the list takes a new block from the arena and abandons the old one until the arena is
+     * freed, so a list that knows its degree should Reserve it first: its arcs then take a
+     * single block. Without an arena, the storage comes from operator new.
+     **/
+    class AdjacencyList
+    {
+        private:
+            static constexpr uint32_t INITIAL_CAPACITY = 4;
+
+            Arena* m_arena; // Arena that owns the storage, null to use operator new
+            Arc* m_arcs; // Storage of the arcs
+            uint32_t m_size; // Number of arcs in the list
+            uint32_t m_capacity; // Number of arcs that fit in the storage
+
+            /**
+             * @brief Move the arcs to a storage with the given capacity
+             **/
+            void Grow(uint32_t capacity);
+
+            /**
+             * @brief Empty the list and release the storage, if it is not from an arena
+             **/
+            void Release();
+
+        public:
+            AdjacencyList();
+
+            /**
+             * @brief Copy constructor. The copy uses the same arena as the other list
+             **/
+            AdjacencyList(const AdjacencyList &other);
+
+            /**
+             * @brief Copy assignment operator. The list keeps its own arena, if any
+             **/
+            AdjacencyList &operator=(const AdjacencyList &other);
+
+            ~AdjacencyList();
+
+            /**
+             * @brief Set the arena that provides the storage. The arcs already in the list are
+             *        moved to it
+             **/
+            void SetArena(Arena* arena);
+
+            /**
+             * @brief Make room for the given number of arcs, so that adding them does not grow
+             *        the storage
+             **/
+            void Reserve(std::size_t capacity);
+
+            /**
+             * @brief Add an arc to the end of the list
+             **/
+            void PushBack(const Arc &arc);
+
+            /**
+             * @return Number of arcs in the list
+             **/
+            std::size_t Size() const;
+
+            inline const Arc &At(std::size_t i) const
+            {
+                return this->m_arcs[i];
+            }
+
+            inline const Arc &operator[](std::size_t i) const
+            {
+                return this->m_arcs[i];
+            }
+
+            inline const Arc* begin() const
+            {
+                return this->m_arcs;
+            }
+
+            inline const Arc* end() const
+            {
+                return this->m_arcs + this->m_size;
+            }
+    };
+}
+
+#endif // ADJACENCY_LIST_H_
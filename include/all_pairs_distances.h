@@ -0,0 +1,120 @@
+/*
+* Filename: all_pairs_distances.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef ALL_PAIRS_DISTANCES_H_
+#define ALL_PAIRS_DISTANCES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <algorithm>
+#include <atomic>
+#include <immintrin.h>
+#include <iostream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "static_graph.h"
+
+namespace geom
+{
+    /**
+     * @brief Distance between every pair of vertices, with blocked Floyd-Warshall
+     *
+     * The N x N matrix is split in tiles of BLOCK_SIZE x BLOCK_SIZE distances that fit in
+     * the L1 cache. For each block k, the diagonal tile is closed first, then the tiles of
+     * row and column k, and then all the other tiles, each step depending only on the
+     * previous one. The tiles of a step are independent and are spread over the threads.
+     * Each tile update is a min-plus product, vectorized with AVX2 when the CPU supports it.
+     *
+     * It takes O(N³) time and 8 N² bytes, so it is meant for graphs with a few thousand
+     * vertices.
+     **/
+    class AllPairsDistances
+    {
+        public:
+            static constexpr uint32_t FILE_MAGIC = 0x50535041; // "APSP"
+            static constexpr uint32_t FILE_VERSION = 1;
+
+        private:
+            static constexpr std::size_t BLOCK_SIZE = 64; // Distances per side of a tile
+
+            // Distance of the unreachable pairs. Twice of it still fits in a signed 64-bit
+            // integer, so the sums never overflow and AVX2 can compare them
+            static constexpr uint64_t UNREACHABLE = INT64_MAX / 2;
+
+            // Min-plus update of tile c with tiles a and b: c[i][j] = min(c[i][j], a[i][k] + b[k][j])
+            typedef void (*MinPlus)(uint64_t* c, const uint64_t* a, const uint64_t* b, std::size_t stride);
+
+            const StaticGraph* m_graph; // Graph whose distances are computed
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the distances
+            std::size_t m_numThreads; // Number of threads that update the tiles
+            std::size_t m_numVertices; // Number of vertices (N)
+            std::size_t m_stride; // N rounded up to a whole number of tiles
+
+            Vector<uint64_t> m_dist; // Row-major distance matrix, m_stride x m_stride
+            MinPlus m_minPlus; // Kernel of the tile updates
+
+            static void MinPlusScalar(uint64_t* c, const uint64_t* a, const uint64_t* b, std::size_t stride);
+            static void MinPlusAVX2(uint64_t* c, const uint64_t* a, const uint64_t* b, std::size_t stride);
+
+            /**
+             * @return Pointer to the first distance of the tile in block row i and block column j
+             **/
+            inline uint64_t* Tile(std::size_t i, std::size_t j)
+            {
+                return &this->m_dist[(i * this->m_stride + j) * BLOCK_SIZE];
+            }
+
+            /**
+             * @brief Update, in parallel, each tile (i, j) of a list with the tiles (i, k) and (k, j)
+             **/
+            void UpdateTiles(const std::vector<std::pair<std::size_t, std::size_t>> &tiles, std::size_t k);
+
+        public:
+            /**
+             * @param graph Graph whose distances are computed
+             * @param numThreads Number of threads, 0 to use one per hardware thread
+             * @param edgeInfo Type of cost considered in the distances
+             **/
+            AllPairsDistances(const StaticGraph &graph, std::size_t numThreads = 0,
+                              Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            ~AllPairsDistances();
+
+            /**
+             * @brief Compute the distance between every pair of vertices
+             **/
+            void Run();
+
+            /**
+             * @return Number of vertices (N)
+             **/
+            std::size_t GetNumVertices() const;
+
+            /**
+             * @return Distance from vertex u to vertex v computed by Run, infinity if unreachable
+             **/
+            inline std::size_t GetDistance(std::size_t u, std::size_t v) const
+            {
+                uint64_t dist = this->m_dist[u * this->m_stride + v];
+                return dist >= UNREACHABLE ? Defs::INFINITY_VALUE : dist;
+            }
+
+            /**
+             * @brief Write the distances to a binary file: a header with FILE_MAGIC,
+             *        FILE_VERSION and the type of cost (3 x uint32), N (uint64) and the N x N
+             *        row-major matrix (uint64), with UINT64_MAX for the unreachable pairs
+             * @param fileName Name of the file
+             * @return True if the file was written
+             **/
+            bool Save(const char* fileName) const;
+    };
+}
+
+#endif // ALL_PAIRS_DISTANCES_H_
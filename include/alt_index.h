@@ -0,0 +1,127 @@
+/*
+* Filename: alt_index.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef ALT_INDEX_H_
+#define ALT_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "path.h"
+#include "static_graph.h"
+#include "shortest_path_tree.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief ALT (A*, landmarks and triangle inequality) point-to-point queries
+     *
+     * The distances from k landmarks to every vertex are precomputed. For any landmark L,
+     * |d(L, t) - d(L, v)| is a lower bound of d(v, t), and the largest of these bounds is
+     * the potential used by A* to guide the search towards t.
+     **/
+    class ALTIndex
+    {
+        public:
+            enum SELECTION { FARTHEST, DEGREE };
+
+        private:
+            static constexpr uint32_t UNREACHABLE = UINT32_MAX; // Landmark distance of unreachable vertices
+
+            // Queue entry: (distance + potential, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> Entry;
+
+            struct CompareEntry
+            {
+                bool operator()(const Entry &e1, const Entry &e2) const
+                {
+                    return e1.first < e2.first;
+                }
+            };
+
+            const StaticGraph* m_graph; // Graph being queried
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the queries
+            std::size_t m_numLandmarks; // Number of landmarks (k)
+
+            Vector<Defs::VertexID> m_landmarks; // ID of each landmark
+            Vector<uint32_t> m_landmarkDist; // Distances to the landmarks, k per vertex, saturated to 32 bits
+
+            // Query workspace
+            uint32_t m_query; // Number of the current query, used as stamp
+            Vector<std::size_t> m_dist; // Tentative distances from s
+            Vector<std::size_t> m_potential; // Lower bound of the distance to t
+            Vector<Defs::VertexID> m_parent; // Parent vertex in the search tree
+            Vector<uint32_t> m_reached; // Query in which the vertex was last reached
+            Vector<uint32_t> m_targetDist; // Distances from t to the landmarks
+            heap::PriorityQueue<Entry, CompareEntry> m_queue;
+
+            /**
+             * @brief Choose the vertices with the largest degrees as landmarks. Each thread
+             *        keeps the best candidates of a range of vertices, which are then merged
+             **/
+            void SelectByDegree(std::size_t numThreads);
+
+            /**
+             * @brief Compute the distances from the landmarks to every vertex, one Dijkstra
+             *        per landmark, spread among the threads
+             * @param first First landmark whose distances are not computed yet
+             **/
+            void ComputeDistances(std::size_t first, std::size_t numThreads);
+
+            /**
+             * @brief Copy the distances of a finished tree to the column of a landmark
+             **/
+            void StoreDistances(std::size_t landmark, const ShortestPathTree &tree);
+
+            /**
+             * @return Lower bound of the distance from the vertex to the target of the query
+             **/
+            std::size_t Potential(std::size_t vertexID) const;
+
+        public:
+            /**
+             * @brief Select the landmarks and compute their distances
+             * @param graph Graph being queried
+             * @param numLandmarks Number of landmarks (k)
+             * @param selection How the landmarks are chosen. FARTHEST picks each landmark as
+             *        the vertex farthest from the ones already chosen, DEGREE picks the vertices
+             *        with the largest degrees
+             * @param numThreads Number of worker threads, 0 to use one per hardware thread
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             **/
+            ALTIndex(const StaticGraph &graph, std::size_t numLandmarks, SELECTION selection = FARTHEST,
+                     std::size_t numThreads = 0, Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            ~ALTIndex();
+
+            /**
+             * @brief Find the shortest path between two vertices with A*
+             * @param source ID of the vertex s
+             * @param target ID of the vertex t
+             * @return The cost of the shortest path and its vertices, from s to t
+             **/
+            Path Query(std::size_t source, std::size_t target);
+
+            /**
+             * @return Number of landmarks
+             **/
+            std::size_t GetNumLandmarks() const;
+
+            /**
+             * @return ID of the i-th landmark
+             **/
+            std::size_t GetLandmark(std::size_t i) const;
+    };
+}
+
+#endif // ALT_INDEX_H_
@@ -0,0 +1,120 @@
+/*
+* Filename: arc.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef ARC_H_
+#define ARC_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "definitions.h"
+
+namespace geom
+{
+    /**
+     * @brief Entry of an adjacency: the vertex it points to, the edge it was created from and
+     *        the three weights of that edge, in a single record
+     *
+     * By default the weights are packed in one 64-bit word: 27 bits of year, then 17 bits of
+     * time and 17 bits of cost, which covers the documented ranges (year <= 10^8, time and
+     * cost <= 10^5). With 32-bit IDs an arc takes 16 bytes. The layout is fixed at build time,
+     * so reading a weight never branches on it. Graphs with larger weights are still taken:
+     * Graph and StaticGraph then read every weight from a wide copy instead of the arcs (see
+     * Graph::GetWeight). Building with WEIGHTS=wide stores one 32-bit word per weight in the
+     * arcs instead, for inputs that are known to need it.
+     **/
+    class Arc
+    {
+        public:
+#ifdef GEOM_WIDE_WEIGHTS
+            static constexpr bool PACKED = false;
+#else
+            static constexpr bool PACKED = true;
+
+            // Position and width of each weight in the packed word, indexed by Defs::EDGE_INFO
+            static constexpr uint32_t PACKED_SHIFT[3] = { 0, 27, 44 };
+            static constexpr uint32_t PACKED_BITS[3] = { 27, 17, 17 };
+#endif
+
+        private:
+            Defs::VertexID m_head; // ID of the vertex the arc points to
+            Defs::EdgeID m_edgeID; // ID of the edge from which the arc was created
+#ifdef GEOM_WIDE_WEIGHTS
+            uint32_t m_weights[3]; // Weights of the edge, indexed by Defs::EDGE_INFO
+#else
+            uint64_t m_weights; // Weights of the edge, packed
+#endif
+
+        public:
+            Arc() = default;
+
+            /**
+             * @param head ID of the vertex the arc points to
+             * @param edgeID ID of the edge from which the arc was created
+             * @param constructionYear, crossingTime, buildCost Weights of the edge, they must Fit
+             **/
+            Arc(Defs::VertexID head, Defs::EdgeID edgeID, uint32_t constructionYear, uint32_t crossingTime,
+                uint32_t buildCost)
+            {
+                this->m_head = head;
+                this->m_edgeID = edgeID;
+#ifdef GEOM_WIDE_WEIGHTS
+                this->m_weights[Defs::YEAR] = constructionYear;
+                this->m_weights[Defs::TIME] = crossingTime;
+                this->m_weights[Defs::COST] = buildCost;
+#else
+                this->m_weights = uint64_t(constructionYear) << PACKED_SHIFT[Defs::YEAR] |
+                                  uint64_t(crossingTime) << PACKED_SHIFT[Defs::TIME] |
+                                  uint64_t(buildCost) << PACKED_SHIFT[Defs::COST];
+#endif
+            }
+
+            /**
+             * @return True if the weights can be stored in an arc of this build
+             **/
+            static inline bool Fits(uint32_t constructionYear, uint32_t crossingTime, uint32_t buildCost)
+            {
+#ifdef GEOM_WIDE_WEIGHTS
+                return true;
+#else
+                return (constructionYear >> PACKED_BITS[Defs::YEAR]) == 0 and
+                       (crossingTime >> PACKED_BITS[Defs::TIME]) == 0 and
+                       (buildCost >> PACKED_BITS[Defs::COST]) == 0;
+#endif
+            }
+
+            /**
+             * @return ID of the vertex the arc points to
+             **/
+            inline Defs::VertexID GetHead() const
+            {
+                return this->m_head;
+            }
+
+            /**
+             * @return ID of the edge from which the arc was created
+             **/
+            inline Defs::EdgeID GetEdgeID() const
+            {
+                return this->m_edgeID;
+            }
+
+            /**
+             * @param edgeInfo Type of the cost
+             * @return The specified cost of the edge
+             **/
+            inline uint32_t GetWeight(Defs::EDGE_INFO edgeInfo) const
+            {
+#ifdef GEOM_WIDE_WEIGHTS
+                return this->m_weights[edgeInfo];
+#else
+                return (this->m_weights >> PACKED_SHIFT[edgeInfo]) & ((uint64_t(1) << PACKED_BITS[edgeInfo]) - 1);
+#endif
+            }
+    };
+}
+
+#endif // ARC_H_
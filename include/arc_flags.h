@@ -0,0 +1,106 @@
+/*
+* Filename: arc_flags.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef ARC_FLAGS_H_
+#define ARC_FLAGS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "path.h"
+#include "static_graph.h"
+#include "shortest_path_tree.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief Arc-flags point-to-point queries
+     *
+     * The vertices are split into regions and each arc gets a flag per region telling
+     * whether it lies on some shortest path into that region. A query towards t is a
+     * Dijkstra that ignores the arcs without the flag of the region of t.
+     **/
+    class ArcFlags
+    {
+        private:
+            // Queue entry: (distance, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> Entry;
+
+            struct CompareEntry
+            {
+                bool operator()(const Entry &e1, const Entry &e2) const
+                {
+                    return e1.first < e2.first;
+                }
+            };
+
+            const StaticGraph* m_graph; // Graph being queried, with its arc flags
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost for which the flags were computed
+            bool m_hasFlags; // Whether the graph had arc flags when the object was built
+
+            // Query workspace
+            uint32_t m_query; // Number of the current query, used as stamp
+            Vector<std::size_t> m_dist; // Tentative distances from s
+            Vector<Defs::VertexID> m_parent; // Parent vertex in the search tree
+            Vector<uint32_t> m_reached; // Query in which the vertex was last reached
+            heap::PriorityQueue<Entry, CompareEntry> m_queue;
+
+            /**
+             * @brief Split the vertices into regions of about the same size, each one grown
+             *        by a breadth-first search so that it is connected whenever possible
+             **/
+            static void Partition(StaticGraph &graph, std::size_t numRegions);
+
+        public:
+            /**
+             * @brief Partition the graph and compute the flags of every arc
+             *
+             * The arcs inside a region get its flag. For each boundary vertex b of a region
+             * (a vertex with a neighbor in another region), a Dijkstra from b flags every arc
+             * (u, v) with d(u, b) = w(u, v) + d(v, b). The boundary vertices are spread among
+             * the threads.
+             *
+             * @param graph Graph that will receive the regions and the flags
+             * @param numRegions Number of regions
+             * @param numThreads Number of worker threads, 0 to use one per hardware thread
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             **/
+            static void Preprocess(StaticGraph &graph, std::size_t numRegions, std::size_t numThreads = 0,
+                                   Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            /**
+             * @param graph Graph being queried, already preprocessed. If it has no arc flags,
+             *        the error is reported and every query answers that t is unreachable
+             **/
+            ArcFlags(const StaticGraph &graph);
+
+            ~ArcFlags();
+
+            /**
+             * @brief Find the shortest path between two vertices
+             * @param source ID of the vertex s
+             * @param target ID of the vertex t
+             * @return The cost of the shortest path and its vertices, from s to t
+             **/
+            Path Query(std::size_t source, std::size_t target);
+
+            /**
+             * @return True if the graph had arc flags when the object was built, so the
+             *         queries can be answered
+             **/
+            bool HasFlags() const;
+    };
+}
+
+#endif // ARC_FLAGS_H_
@@ -0,0 +1,128 @@
+/*
+* Filename: arena.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#include <new>
+
+namespace geom
+{
+    /**
+     * @brief Monotonic (bump) allocator
+     *
+     * Memory is handed out from large blocks by advancing a pointer, and is never released
+     * one allocation at a time: all the blocks are freed together when the arena is destroyed.
+     * Each allocation served from a block is one malloc call avoided.
+     **/
+    class Arena
+    {
+        private:
+            // Header of each block, the blocks form a list so they can be freed
+            struct Block
+            {
+                Block* m_next;
+            };
+
+            std::size_t m_blockSize; // Size of the regular blocks, in bytes
+            Block* m_blocks; // Last block allocated
+            char* m_current; // Next free byte of the last block
+            char* m_end; // End of the last block
+            std::size_t m_numAllocations; // Number of allocations served
+            std::size_t m_numBlocks; // Number of blocks allocated with malloc
+
+            /**
+             * @brief Allocate a block with malloc and put it in the list of blocks
+             * @return Address of the first usable byte of the block
+             **/
+            char* NewBlock(std::size_t size);
+
+        public:
+            static constexpr std::size_t DEFAULT_BLOCK_SIZE = 1 << 20;
+
+            /**
+             * @param blockSize Size of the blocks requested to malloc, in bytes
+             **/
+            Arena(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+            /**
+             * @brief Free every block at once
+             **/
+            ~Arena();
+
+            Arena(const Arena &other) = delete;
+            Arena &operator=(const Arena &other) = delete;
+
+            /**
+             * @brief Allocate memory from the current block. Allocations larger than a block
+             *        get a block of their own
+             * @param size Number of bytes
+             * @param alignment Alignment of the address, a power of two
+             * @return Address of the memory, valid until the arena is destroyed
+             **/
+            void* Allocate(std::size_t size, std::size_t alignment);
+
+            /**
+             * @return Number of allocations served by the arena
+             **/
+            std::size_t GetNumAllocations() const;
+
+            /**
+             * @return Number of malloc calls made by the arena
+             **/
+            std::size_t GetNumBlocks() const;
+
+            /**
+             * @return Number of malloc calls avoided, that is, allocations that did not need a
+             *         block of their own
+             **/
+            std::size_t GetNumMallocsAvoided() const;
+    };
+
+    /**
+     * @brief Standard allocator over an Arena, to be used with std::allocate_shared and the
+     *        containers of the standard library. Deallocation does nothing, the memory is
+     *        released with the arena
+     **/
+    template<typename T>
+    class ArenaAllocator
+    {
+        public:
+            typedef T value_type;
+
+            Arena* m_arena; // Arena that owns the memory
+
+            ArenaAllocator(Arena* arena) : m_arena(arena) { }
+
+            template<typename U>
+            ArenaAllocator(const ArenaAllocator<U> &other) : m_arena(other.m_arena) { }
+
+            T* allocate(std::size_t n)
+            {
+                return static_cast<T*>(this->m_arena->Allocate(n * sizeof(T), alignof(T)));
+            }
+
+            void deallocate(T* pointer, std::size_t n) { }
+
+            template<typename U>
+            bool operator==(const ArenaAllocator<U> &other) const
+            {
+                return this->m_arena == other.m_arena;
+            }
+
+            template<typename U>
+            bool operator!=(const ArenaAllocator<U> &other) const
+            {
+                return this->m_arena != other.m_arena;
+            }
+    };
+}
+
+#endif // ARENA_H_
@@ -0,0 +1,78 @@
+/*
+* Filename: batch_shortest_paths.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef BATCH_SHORTEST_PATHS_H_
+#define BATCH_SHORTEST_PATHS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "static_graph.h"
+#include "shortest_path_tree.h"
+
+namespace geom
+{
+    /**
+     * @brief Shortest path trees from many sources, computed in parallel
+     *
+     * Each worker thread takes the next source of the batch and runs a Dijkstra over the
+     * shared read-only graph with its own workspace. The workspaces are kept between
+     * batches. The tree of each source is handed to a consumer as soon as it is ready and
+     * the workspace is then reused, so the memory is proportional to the number of
+     * threads and not to the number of sources.
+     **/
+    class BatchShortestPaths
+    {
+        public:
+            /**
+             * @brief Receives the tree of a source. It runs on the worker thread, so it may be
+             *        called concurrently for different sources and must be thread safe. The
+             *        tree is only valid until the consumer returns
+             **/
+            typedef std::function<void(std::size_t source, const ShortestPathTree &tree)> Consumer;
+
+        private:
+            const StaticGraph* m_graph; // Graph being searched
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the searches
+            std::vector<std::unique_ptr<ShortestPathTree>> m_workspaces; // Workspace of each worker
+
+        public:
+            /**
+             * @param graph Graph being searched
+             * @param numThreads Number of worker threads, 0 to use one per hardware thread
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             **/
+            BatchShortestPaths(const StaticGraph &graph, std::size_t numThreads = 0,
+                               Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            ~BatchShortestPaths();
+
+            /**
+             * @brief Compute the shortest path tree of each source. If the consumer throws,
+             *        the remaining sources are skipped and the first exception is rethrown
+             *        once every worker has stopped
+             * @param sources ID of the source vertices
+             * @param consumer Function that receives each tree
+             **/
+            void Run(const Vector<std::size_t> &sources, const Consumer &consumer);
+
+            /**
+             * @return Number of worker threads
+             **/
+            std::size_t GetNumThreads() const;
+    };
+}
+
+#endif // BATCH_SHORTEST_PATHS_H_
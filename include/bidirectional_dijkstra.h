@@ -0,0 +1,91 @@
+/*
+* Filename: bidirectional_dijkstra.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef BIDIRECTIONAL_DIJKSTRA_H_
+#define BIDIRECTIONAL_DIJKSTRA_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <utility>
+
+#include "path.h"
+#include "static_graph.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief Point-to-point shortest path queries with bidirectional Dijkstra
+     *
+     * A forward search from s and a backward search from t are run alternately and the
+     * query stops when the sum of the last keys settled by both searches reaches the best
+     * s-t cost found so far. The workspace (distances, parents and queues) is owned by the
+     * object and stamped with the query number, so nothing proportional to the number of
+     * vertices is cleared between queries.
+     **/
+    class BidirectionalDijkstra
+    {
+        private:
+            enum DIRECTION { FORWARD, BACKWARD };
+
+            // Queue entry: (distance, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> Entry;
+
+            struct CompareEntry
+            {
+                bool operator()(const Entry &e1, const Entry &e2) const
+                {
+                    return e1.first < e2.first;
+                }
+            };
+
+            const StaticGraph* m_graph; // Graph being queried
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the queries
+            uint32_t m_query; // Number of the current query, used as stamp
+
+            Vector<std::size_t> m_dist[2]; // Tentative distances of each search
+            Vector<Defs::VertexID> m_parent[2]; // Parent vertex in the tree of each search
+            Vector<uint32_t> m_reached[2]; // Query in which the distance was last written
+            Vector<uint32_t> m_settled[2]; // Query in which the vertex was last settled
+            heap::PriorityQueue<Entry, CompareEntry> m_queue[2]; // Queue of each search
+
+            /**
+             * @brief Start a new query, invalidating every stamp of the previous one
+             **/
+            void NewQuery();
+
+            /**
+             * @return Distance of the vertex in the search dir, infinity if not reached yet
+             **/
+            std::size_t GetDistance(DIRECTION dir, std::size_t vertexID) const;
+
+            /**
+             * @brief Remove the entries left in the queues by an early stop
+             **/
+            void ClearQueues();
+
+        public:
+            /**
+             * @param graph Graph being queried
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             **/
+            BidirectionalDijkstra(const StaticGraph &graph,
+                                  Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            ~BidirectionalDijkstra();
+
+            /**
+             * @brief Find the shortest path between two vertices
+             * @param source ID of the vertex s
+             * @param target ID of the vertex t
+             * @return The cost of the shortest path and its vertices, from s to t
+             **/
+            Path Query(std::size_t source, std::size_t target);
+    };
+}
+
+#endif // BIDIRECTIONAL_DIJKSTRA_H_
@@ -0,0 +1,99 @@
+/*
+* Filename: binary_result.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef BINARY_RESULT_H_
+#define BINARY_RESULT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <iostream>
+#include <vector>
+
+namespace geom
+{
+    /**
+     * @brief Binary file with the results printed by the program, for consumers that map it
+     *        instead of parsing the text
+     *
+     * Every field is little-endian and every array starts at a multiple of 8 bytes:
+     *
+     *   header       FILE_MAGIC, FILE_VERSION, flags, 0 (4 x uint32)
+     *                N, number of MST edges written (2 x uint64)
+     *   distances    Cost of each vertex from the source, UINT64_MAX if unreachable (N x uint64)
+     *   results      Max construction year on the shortest path tree, max construction year
+     *                of the MST by year and build cost of the MST by cost (3 x uint64)
+     *   parents      Only with FLAG_PARENT_EDGES: input index of the edge from each vertex to
+     *                its parent, NO_EDGE for the source and the unreachable ones (N x uint64)
+     *   MST edges    Only with FLAG_MST_EDGES: input index of the edges of the MST by cost
+     *
+     * The input index of an edge is its 0-based line in the edge list.
+     **/
+    class BinaryResult
+    {
+        public:
+            static constexpr uint32_t FILE_MAGIC = 0x54534552; // "REST"
+            static constexpr uint32_t FILE_VERSION = 1;
+
+            static constexpr uint32_t FLAG_PARENT_EDGES = 1 << 0;
+            static constexpr uint32_t FLAG_MST_EDGES = 1 << 1;
+
+            static constexpr uint64_t NO_EDGE = UINT64_MAX;
+
+        private:
+            FILE* m_file; // File being written, nullptr if not open
+            const char* m_fileName; // Name of the file, for the error messages
+            bool m_ok; // False after the first failed write
+
+            /**
+             * @brief Write an array of numbers in little-endian order
+             **/
+            void Write(const uint64_t* values, std::size_t count);
+
+        public:
+            BinaryResult();
+
+            /**
+             * @brief Close the file if it is still open
+             **/
+            ~BinaryResult();
+
+            /**
+             * @brief Create the file and write the header
+             * @param fileName Name of the file, replaced if it exists
+             * @param numVertices N, the length of the distance and parent arrays
+             * @param flags FLAG_PARENT_EDGES and FLAG_MST_EDGES, according to the arrays that
+             *        follow the results
+             * @param numMSTEdges Number of MST edges that will be written, 0 without FLAG_MST_EDGES
+             * @return True if the file was created
+             **/
+            bool Open(const char* fileName, std::size_t numVertices, uint32_t flags, std::size_t numMSTEdges);
+
+            /**
+             * @brief Write the distance array
+             **/
+            void WriteDistances(const std::vector<uint64_t> &distances);
+
+            /**
+             * @brief Write the three numbers printed after the distances
+             **/
+            void WriteResults(uint64_t maxPathYear, uint64_t maxMSTYear, uint64_t mstCost);
+
+            /**
+             * @brief Write an array of edge indices: the parents or the MST edges
+             **/
+            void WriteEdges(const std::vector<uint64_t> &edges);
+
+            /**
+             * @brief Close the file
+             * @return True if everything was written
+             **/
+            bool Close();
+    };
+}
+
+#endif // BINARY_RESULT_H_
@@ -0,0 +1,200 @@
+/*
+* Filename: contraction_hierarchy.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef CONTRACTION_HIERARCHY_H_
+#define CONTRACTION_HIERARCHY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <iostream>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include "path.h"
+#include "static_graph.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief Contraction hierarchies (CH) for fast point-to-point queries
+     *
+     * The vertices are contracted one by one, in the order given by the edge difference
+     * (shortcuts added minus edges removed) plus the number of contracted neighbors. When a
+     * vertex v is contracted, a shortcut {u, w} is added for each pair of neighbors whose
+     * shortest path may pass through v. A query is a bidirectional Dijkstra in which both
+     * searches only go up in the hierarchy.
+     *
+     * The graph is undirected, so the downward graph is the reverse of the upward graph and
+     * both searches run on the same upward CSR.
+     **/
+    class ContractionHierarchy
+    {
+        private:
+            enum DIRECTION { FORWARD, BACKWARD };
+
+            static constexpr Defs::VertexID NO_MIDDLE = std::numeric_limits<Defs::VertexID>::max(); // Middle vertex of an original edge
+            static constexpr Defs::EdgeID NO_ARC = std::numeric_limits<Defs::EdgeID>::max(); // Answer of FindArc when there is no arc
+            static constexpr uint32_t FILE_MAGIC = 0x52474843; // "CHGR"
+            static constexpr uint32_t FILE_VERSION = 2;
+            static constexpr uint32_t ID_WIDTHS = sizeof(Defs::VertexID) << 8 | sizeof(Defs::EdgeID); // Saved in the files
+            static constexpr std::size_t WITNESS_SETTLE_LIMIT = 500; // Vertices settled by a witness search
+
+            // Arc of the graph being contracted
+            struct DynamicArc
+            {
+                Defs::VertexID m_head; // Vertex the arc points to
+                Defs::VertexID m_middle; // Contracted vertex bypassed by the shortcut, NO_MIDDLE if none
+                std::size_t m_weight; // Cost of the arc
+            };
+
+            // Queue entry: (distance or priority, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> Entry;
+            typedef std::pair<int64_t, Defs::VertexID> PriorityEntry;
+
+            template<typename T>
+            struct CompareEntry
+            {
+                bool operator()(const T &e1, const T &e2) const
+                {
+                    return e1.first < e2.first;
+                }
+            };
+
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost of the hierarchy
+            std::size_t m_numVertices; // Number of vertices
+
+            Vector<Defs::VertexID> m_rank; // Contraction order of each vertex
+            Vector<Defs::EdgeID> m_firstArc; // Upward CSR: first arc of each vertex (size N + 1)
+            Vector<Defs::VertexID> m_heads; // Upward CSR: head of each arc (always of higher rank)
+            Vector<Defs::VertexID> m_middles; // Upward CSR: middle vertex of each shortcut
+            Vector<std::size_t> m_weights; // Upward CSR: cost of each arc
+
+            // Query workspace
+            uint32_t m_query; // Number of the current query, used as stamp
+            Vector<std::size_t> m_dist[2]; // Tentative distances of each search
+            Vector<Defs::VertexID> m_parent[2]; // Parent vertex in the tree of each search
+            Vector<uint32_t> m_reached[2]; // Query in which the distance was last written
+            heap::PriorityQueue<Entry, CompareEntry<Entry>> m_queue[2]; // Queue of each search
+
+            // Preprocessing workspace
+            Vector<Vector<DynamicArc>> m_arcs; // Remaining graph with its shortcuts
+            Vector<Defs::EdgeID> m_numArcs; // Number of live arcs at the front of each list
+            Vector<uint8_t> m_contracted; // Whether each vertex was contracted
+            Vector<Defs::EdgeID> m_position; // Position + 1 of each vertex in the neighbor list
+            Vector<std::size_t> m_witnessDist; // Distances of the witness search
+            Vector<Defs::VertexID> m_witnessTouched; // Vertices reached by the witness search
+            std::size_t m_numWitnessTouched; // Number of vertices reached by the witness search
+
+            /**
+             * @brief Allocate the query workspace for the current number of vertices
+             **/
+            void InitQueryWorkspace();
+
+            /**
+             * @brief Dijkstra from source in the remaining graph, ignoring the vertex being
+             *        contracted. Stops at maxDist, after WITNESS_SETTLE_LIMIT vertices or when
+             *        the numTargets neighbors placed after source in the neighbor list are settled
+             **/
+            void WitnessSearch(Defs::VertexID source, Defs::VertexID ignored, std::size_t maxDist,
+                               std::size_t numTargets);
+
+            /**
+             * @brief Reset the distances written by the last witness search
+             **/
+            void ClearWitnessSearch();
+
+            /**
+             * @brief Append an arc to the live part of the adjacency list of a vertex
+             **/
+            void AppendArc(Defs::VertexID vertexID, const DynamicArc &arc);
+
+            /**
+             * @brief Drop the arcs of a vertex that point to contracted vertices
+             **/
+            void RemoveContractedArcs(Defs::VertexID vertexID);
+
+            /**
+             * @brief Add the shortcut {u, w}, or lower the cost of the existing arc {u, w}
+             **/
+            void AddShortcut(Defs::VertexID u, Defs::VertexID w, std::size_t weight, Defs::VertexID middle);
+
+            /**
+             * @brief Contract a vertex, or only simulate its contraction
+             * @param vertexID Vertex to be contracted
+             * @param simulate If true, no shortcut is added
+             * @return Edge difference (shortcuts added minus edges removed)
+             **/
+            int64_t ContractVertex(Defs::VertexID vertexID, bool simulate);
+
+            /**
+             * @return Position of the cheapest arc between u and w in the upward CSR, NO_ARC if
+             *         there is none
+             **/
+            Defs::EdgeID FindArc(Defs::VertexID u, Defs::VertexID w) const;
+
+            /**
+             * @brief Append to path the original vertices from u (exclusive) to w (inclusive)
+             **/
+            void Unpack(Defs::VertexID u, Defs::VertexID w, Vector<std::size_t> &path) const;
+
+        public:
+            ContractionHierarchy();
+
+            ~ContractionHierarchy();
+
+            /**
+             * @brief Contract the whole graph and build the upward CSR
+             * @param graph Graph to be preprocessed
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             **/
+            void Build(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            /**
+             * @brief Save the preprocessed hierarchy to a binary file
+             * @param fileName Name of the file
+             * @return True if the file was written, False otherwise
+             **/
+            bool Save(const char* fileName) const;
+
+            /**
+             * @brief Load a hierarchy previously saved with Save. The file is rejected, and
+             *        the current hierarchy kept, if its sizes do not match its length or the
+             *        graph, or if its ranks and arcs are not a valid hierarchy
+             * @param fileName Name of the file
+             * @param graph Graph from which the hierarchy was built
+             * @return True if the file was read, False otherwise
+             **/
+            bool Load(const char* fileName, const StaticGraph &graph);
+
+            /**
+             * @brief Find the shortest path between two vertices
+             * @param source ID of the vertex s
+             * @param target ID of the vertex t
+             * @return The cost of the shortest path and its vertices, from s to t
+             **/
+            Path Query(std::size_t source, std::size_t target);
+
+            /**
+             * @brief Compare the answers of the hierarchy against Graph::Dijkstra on random pairs
+             * @param graph Graph from which the hierarchy was built, through its StaticGraph
+             * @param numPairs Number of random (s, t) pairs
+             * @param seed Seed of the random generator
+             * @return Number of pairs in which the costs differ
+             **/
+            std::size_t Verify(Graph &graph, std::size_t numPairs, uint32_t seed = 0);
+
+            /**
+             * @return Number of arcs in the upward CSR
+             **/
+            std::size_t GetNumArcs() const;
+    };
+}
+
+#endif // CONTRACTION_HIERARCHY_H_
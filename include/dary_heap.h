@@ -0,0 +1,303 @@
+/*
+* Filename: dary_heap.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef DARY_HEAP_H_
+#define DARY_HEAP_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <immintrin.h>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace heap
+{
+    /**
+     * @return Position (0 to 7) of the smallest of 8 consecutive keys, compared one by one
+     **/
+    inline std::size_t MinOfEightScalar(const uint64_t* keys)
+    {
+        std::size_t min = 0;
+
+        for (std::size_t i = 1; i < 8; i++)
+        {
+            if (keys[i] < keys[min])
+                min = i;
+        }
+
+        return min;
+    }
+
+    /**
+     * @return Position (0 to 7) of the smallest of 8 consecutive keys, found with AVX2. The
+     *         keys must be smaller than 2^63, since AVX2 only compares signed 64-bit integers
+     **/
+    std::size_t MinOfEightAVX2(const uint64_t* keys);
+
+    typedef std::size_t (*MinOfEight)(const uint64_t* keys);
+
+    /**
+     * @return MinOfEightAVX2 if the processor supports AVX2, MinOfEightScalar otherwise
+     **/
+    MinOfEight SelectMinOfEight();
+
+    /**
+     * @brief Min-heap with 8 children per node and integer keys
+     *
+     * The keys and the values are kept in separate arrays, and the 8 children of a node are
+     * contiguous, 64 bytes of keys. The tree is a third as deep as a binary heap. The positions
+     * past the last entry hold EMPTY_KEY, so every group of children can be read whole.
+     *
+     * The smallest child is found by the scalar loop, inlined in the sift-down. The AVX2
+     * kernel is opt-in, since it does not beat that loop in make bench and it costs an
+     * indirect call per level.
+     *
+     * A heap can be built from a range of entries in O(n), and a batch of k entries can be
+     * added in O(k + log² n), both restoring the heap order bottom-up.
+     *
+     * Entries with the same key come out by increasing value, so the order of the removals
+     * does not depend on the shape of the heap.
+     *
+     * @tparam T Type of the values, compared with <
+     **/
+    template<typename T>
+    class DaryHeap
+    {
+        public:
+            typedef std::pair<uint64_t, T> Entry; // (key, value)
+
+            static constexpr uint64_t EMPTY_KEY = INT64_MAX; // Keys must be smaller than this
+
+        private:
+            static constexpr std::size_t ARITY = 8;
+
+            std::vector<uint64_t> m_keys; // Key of each node
+            std::vector<T> m_values; // Value of each node
+            std::size_t m_size; // Number of entries in the heap
+            MinOfEight m_minOfEight; // Kernel that picks the smallest child, null for the inlined scalar loop
+
+            /**
+             * @brief Make room for the given number of entries plus a whole group of children
+             *        past the last one
+             **/
+            void Reserve(std::size_t size)
+            {
+                if (size + ARITY >= this->m_keys.size())
+                {
+                    this->m_keys.resize(std::max(2 * this->m_keys.size(), size + ARITY + 1), EMPTY_KEY);
+                    this->m_values.resize(this->m_keys.size());
+                }
+            }
+
+            /**
+             * @return True if the entry (key1, value1) comes out before (key2, value2)
+             **/
+            static inline bool Precedes(uint64_t key1, const T &value1, uint64_t key2, const T &value2)
+            {
+                return key1 < key2 or (key1 == key2 and value1 < value2);
+            }
+
+            /**
+             * @return Position of the smallest of the 8 children starting at position first,
+             *         the one with the smallest value among equal keys
+             **/
+            std::size_t MinChild(std::size_t first) const
+            {
+                const uint64_t* keys = &this->m_keys[first];
+                const T* values = &this->m_values[first];
+
+                // The first smallest key, then the ties after it, which are rare
+                std::size_t min = this->m_minOfEight == nullptr ? MinOfEightScalar(keys) : this->m_minOfEight(keys);
+
+                for (std::size_t i = min + 1; i < ARITY; i++)
+                {
+                    if (keys[i] == keys[min] and values[i] < values[min])
+                        min = i;
+                }
+
+                return first + min;
+            }
+
+            /**
+             * @brief Move the entry at position i down until it is not larger than its children
+             **/
+            void SiftDown(std::size_t i)
+            {
+                uint64_t key = this->m_keys[i];
+                T value = std::move(this->m_values[i]);
+
+                // Auxiliar variables to make code most legible
+                std::size_t child;
+
+                // Move the smallest child up to the hole
+                while (ARITY * i + 1 < this->m_size)
+                {
+                    child = this->MinChild(ARITY * i + 1);
+
+                    if (not Precedes(this->m_keys[child], this->m_values[child], key, value))
+                        break;
+
+                    this->m_keys[i] = this->m_keys[child];
+                    this->m_values[i] = std::move(this->m_values[child]);
+                    i = child;
+                }
+
+                this->m_keys[i] = key;
+                this->m_values[i] = std::move(value);
+            }
+
+            /**
+             * @brief Restore the heap order after entries were appended at the positions
+             *        [first, m_size), sifting down their ancestors level by level, from the
+             *        bottom up. Each level has about 1/8 of the positions of the level below
+             **/
+            void Heapify(std::size_t first)
+            {
+                if (this->m_size < 2)
+                    return;
+
+                std::size_t low = first;
+                std::size_t high = this->m_size - 1;
+
+                while (high > 0)
+                {
+                    low = low > 0 ? (low - 1) / ARITY : 0;
+                    high = (high - 1) / ARITY;
+
+                    for (std::size_t i = high + 1; i > low; i--)
+                        this->SiftDown(i - 1);
+                }
+            }
+
+        public:
+            /**
+             * @param useSIMD True to use AVX2 when the processor supports it, False (default)
+             *        to compare the children one by one
+             **/
+            DaryHeap(bool useSIMD = false)
+            {
+                this->m_size = 0;
+                this->m_minOfEight = useSIMD ? SelectMinOfEight() : nullptr;
+                this->m_keys.assign(ARITY, EMPTY_KEY);
+                this->m_values.resize(ARITY);
+            }
+
+            /**
+             * @brief Build a heap from a range of entries in O(n)
+             * @param first, last Range of entries
+             * @param useSIMD True to use AVX2 when the processor supports it
+             **/
+            template<typename Iterator>
+            DaryHeap(Iterator first, Iterator last, bool useSIMD = false) : DaryHeap(useSIMD)
+            {
+                this->EnqueueBatch(first, last);
+            }
+
+            /**
+             * @brief Add a batch of entries at once. The entries are appended and the heap
+             *        order is restored bottom-up, in O(k + log² n) for k entries:
+             *        each of the log n levels above the batch sifts down an ancestor in O(log n)
+             * @param first, last Range of entries
+             **/
+            template<typename Iterator>
+            void EnqueueBatch(Iterator first, Iterator last)
+            {
+                std::size_t oldSize = this->m_size;
+
+                this->Reserve(this->m_size + std::distance(first, last));
+
+                for (Iterator entry = first; entry != last; entry++)
+                {
+                    this->m_keys[this->m_size] = entry->first;
+                    this->m_values[this->m_size] = entry->second;
+                    this->m_size++;
+                }
+
+                this->Heapify(oldSize);
+            }
+
+            /**
+             * @brief Add an entry to the heap
+             **/
+            void Enqueue(const Entry &entry)
+            {
+                this->Reserve(this->m_size);
+
+                std::size_t i = this->m_size++;
+                std::size_t parent;
+
+                // Sift up, moving the parents down to the hole
+                while (i > 0)
+                {
+                    parent = (i - 1) / ARITY;
+
+                    if (not Precedes(entry.first, entry.second, this->m_keys[parent], this->m_values[parent]))
+                        break;
+
+                    this->m_keys[i] = this->m_keys[parent];
+                    this->m_values[i] = std::move(this->m_values[parent]);
+                    i = parent;
+                }
+
+                this->m_keys[i] = entry.first;
+                this->m_values[i] = entry.second;
+            }
+
+            /**
+             * @brief Remove the entry with the smallest key. The heap must not be empty
+             * @return The removed entry
+             **/
+            Entry Dequeue()
+            {
+                Entry top(this->m_keys[0], std::move(this->m_values[0]));
+
+                this->m_size--;
+
+                // The last entry goes to the root and sifts down
+                if (this->m_size > 0)
+                {
+                    this->m_keys[0] = this->m_keys[this->m_size];
+                    this->m_values[0] = std::move(this->m_values[this->m_size]);
+                }
+
+                this->m_keys[this->m_size] = EMPTY_KEY;
+
+                if (this->m_size > 0)
+                    this->SiftDown(0);
+
+                return top;
+            }
+
+            /**
+             * @return True if the heap has no entries
+             **/
+            bool IsEmpty() const
+            {
+                return this->m_size == 0;
+            }
+
+            /**
+             * @return Number of entries in the heap
+             **/
+            std::size_t Size() const
+            {
+                return this->m_size;
+            }
+
+            /**
+             * @return Number of entries the heap holds without allocating
+             **/
+            std::size_t GetCapacity() const
+            {
+                return this->m_keys.capacity();
+            }
+    };
+}
+
+#endif // DARY_HEAP_H_
@@ -4,11 +4,28 @@
 * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
 */
 
+#ifndef DEFINITIONS_H_
+#define DEFINITIONS_H_
+
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 
 class Defs
 {
     public:
+        // Width of the vertex and edge IDs. 32 bits are enough for the input limits (N, M <=
+        // 10^6) and halve the memory taken by the IDs; build with ID_BITS=64 for larger graphs
+#ifdef GEOM_64BIT_IDS
+        typedef uint64_t VertexID;
+        typedef uint64_t EdgeID;
+#else
+        typedef uint32_t VertexID;
+        typedef uint32_t EdgeID;
+#endif
+
         static constexpr std::size_t INFINITY_VALUE = std::numeric_limits<std::size_t>::max();
         enum EDGE_INFO { YEAR, TIME, COST };
 };
+
+#endif // DEFINITIONS_H_
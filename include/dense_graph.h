@@ -0,0 +1,109 @@
+/*
+* Filename: dense_graph.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef DENSE_GRAPH_H_
+#define DENSE_GRAPH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <immintrin.h>
+#include <mutex>
+#include <vector>
+
+#include "definitions.h"
+#include "vector.h"
+
+namespace geom
+{
+    class Graph;
+
+    /**
+     * @brief Adjacency matrix engine for dense graphs
+     *
+     * When M is close to N², the heap operations dominate Dijkstra and Prim. Here each type of
+     * cost has an N x N matrix with the cheapest edge between each pair of vertices, and both
+     * algorithms run in O(N²): the next vertex is the minimum of a key array, found with a
+     * SIMD scan, and then the row of the vertex is relaxed. The matrices are built the first
+     * time each type of cost is used. The queries keep their state in buffers given by the
+     * caller, so several of them may run at the same time.
+     **/
+    class DenseGraph
+    {
+        public:
+            static constexpr Defs::EdgeID NO_EDGE = ~Defs::EdgeID(0);
+
+        private:
+            static constexpr uint32_t NO_WEIGHT = UINT32_MAX; // Weight of the pairs without edge
+
+            // Keys of the scan. The vertices already taken are never the minimum
+            static constexpr uint64_t TAKEN_KEY = INT64_MAX;
+            static constexpr uint64_t UNREACHED_KEY = INT64_MAX - 1;
+
+            Graph* m_graph; // Graph whose edges fill the matrices
+            std::size_t m_numVertices; // Number of vertices (N)
+
+            Vector<uint32_t> m_weights[3]; // Cheapest weight of each pair, row-major, by Defs::EDGE_INFO
+            Vector<Defs::EdgeID> m_edgeIDs[3]; // ID of the cheapest edge of each pair
+            bool m_built[3]; // Whether the matrices of each type of cost were built
+            std::mutex m_buildMutex; // Guards the construction of the matrices
+
+            // Kernel that finds the position of the smallest key
+            std::size_t (*m_argMin)(const uint64_t* keys, std::size_t size);
+
+            /**
+             * @brief Build the matrices of a type of cost, if not built yet
+             **/
+            void BuildMatrix(Defs::EDGE_INFO edgeInfo);
+
+            /**
+             * @brief Size the key array of a scan, padded to whole SIMD words with keys that
+             *        are never the minimum, if not sized yet
+             **/
+            void ReserveKeys(Vector<uint64_t> &keys) const;
+
+            /**
+             * @return Position of the smallest key, compared one by one or with AVX2. The keys
+             *         must be smaller than 2^63, since AVX2 only compares signed 64-bit integers
+             **/
+            static std::size_t ArgMinScalar(const uint64_t* keys, std::size_t size);
+            static std::size_t ArgMinAVX2(const uint64_t* keys, std::size_t size);
+
+        public:
+            /**
+             * @param graph Graph whose edges fill the matrices. Edges added after the first
+             *        query of a type of cost are not seen by it
+             **/
+            DenseGraph(Graph &graph);
+
+            ~DenseGraph();
+
+            /**
+             * @brief Array-scan Dijkstra
+             * @param source The source vertex from which to calculate the shortest paths
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             * @param keys Key array of the scan, sized on first use
+             * @param cost Receives the cost of each vertex, infinity if unreachable
+             * @param edge2Father Receives the ID of the edge connecting each vertex to its
+             *        parent, NO_EDGE for the source and the unreachable vertices
+             **/
+            void Dijkstra(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, Vector<uint64_t> &keys,
+                          Vector<std::size_t> &cost, Vector<Defs::EdgeID> &edge2Father);
+
+            /**
+             * @brief Array-scan Prim
+             * @param source The source vertex from which to begin the MST calculation
+             * @param edgeInfo Type of cost considered in the MST calculation
+             * @param keys Key array of the scan, sized on first use
+             * @param edge2Tree Buffer for the cheapest edge connecting each vertex to the tree
+             * @param MST Receives the ID of the edges of the tree, after the ones it has
+             **/
+            void PrimMST(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, Vector<uint64_t> &keys,
+                         Vector<Defs::EdgeID> &edge2Tree, std::vector<Defs::EdgeID> &MST);
+    };
+}
+
+#endif // DENSE_GRAPH_H_
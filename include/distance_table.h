@@ -0,0 +1,149 @@
+/*
+* Filename: distance_table.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef DISTANCE_TABLE_H_
+#define DISTANCE_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "static_graph.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief Many-to-many distance table between a set of origins and a set of destinations
+     *
+     * One forward Dijkstra is run from each origin, and it stops as soon as every destination
+     * is settled instead of exploring the whole graph. The origins are shared among worker
+     * threads, each with its own stamped workspace, so nothing proportional to the number of
+     * vertices is cleared between searches. The result is a row-major matrix with one row per
+     * origin and one column per destination.
+     **/
+    class DistanceTable
+    {
+        public:
+            static constexpr uint64_t UNREACHABLE = UINT64_MAX; // Distance of the unreachable pairs
+
+            /**
+             * @brief Cost of the last Compute, to size the jobs
+             **/
+            struct Stats
+            {
+                double m_seconds; // Wall time of the searches
+                std::size_t m_numSettled; // Vertices settled by all searches together
+                std::size_t m_tableBytes; // Memory of the matrix
+                std::size_t m_workspaceBytes; // Memory of the workspaces, with their largest queues
+            };
+
+        private:
+            // Queue entry: (distance, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> Entry;
+
+            struct CompareEntry
+            {
+                bool operator()(const Entry &e1, const Entry &e2) const
+                {
+                    return e1.first < e2.first;
+                }
+            };
+
+            /**
+             * @brief Search state of a worker thread
+             **/
+            struct Workspace
+            {
+                uint32_t m_query; // Number of the current search, used as stamp
+                Vector<std::size_t> m_dist; // Tentative distances
+                Vector<uint32_t> m_reached; // Search in which the distance was last written
+                Vector<uint32_t> m_settled; // Search in which the vertex was last settled
+                heap::PriorityQueue<Entry, CompareEntry> m_queue;
+                std::size_t m_numSettled; // Vertices settled by the searches of this worker
+                std::size_t m_maxQueueSize; // Largest number of entries queued at once
+            };
+
+            const StaticGraph* m_graph; // Graph being searched
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the searches
+            std::vector<std::unique_ptr<Workspace>> m_workspaces; // Workspace of each worker
+
+            Vector<uint8_t> m_isDestination; // Whether each vertex is a destination
+            std::size_t m_numDistinct; // Number of distinct destinations
+
+            Vector<uint64_t> m_table; // Row-major distances, origins x destinations
+            std::size_t m_numOrigins; // Number of rows
+            std::size_t m_numDestinations; // Number of columns
+            Stats m_stats; // Cost of the last Compute
+
+            /**
+             * @brief Start a new search in a workspace, invalidating its previous stamps
+             **/
+            void NewQuery(Workspace* workspace);
+
+            /**
+             * @brief Run a forward search from an origin until every destination is settled,
+             *        and fill its row of the table
+             * @param row Row of the origin in the table
+             **/
+            void Search(Workspace* workspace, std::size_t origin, const Vector<std::size_t> &destinations,
+                        uint64_t* row);
+
+        public:
+            /**
+             * @param graph Graph being searched
+             * @param numThreads Number of worker threads, 0 to use one per hardware thread
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             **/
+            DistanceTable(const StaticGraph &graph, std::size_t numThreads = 0,
+                          Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            ~DistanceTable();
+
+            /**
+             * @brief Compute the distance from each origin to each destination
+             * @param origins ID of the origin vertices, one row each
+             * @param destinations ID of the destination vertices, one column each
+             * @return Time and memory spent
+             **/
+            const Stats &Compute(const Vector<std::size_t> &origins, const Vector<std::size_t> &destinations);
+
+            /**
+             * @return Distance from origin i to destination j, UNREACHABLE if there is no path
+             **/
+            inline uint64_t GetDistance(std::size_t i, std::size_t j) const
+            {
+                return this->m_table[i * this->m_numDestinations + j];
+            }
+
+            /**
+             * @return The row-major table of the last Compute, GetNumOrigins() x GetNumDestinations()
+             **/
+            const uint64_t* GetTable() const;
+
+            std::size_t GetNumOrigins() const;
+            std::size_t GetNumDestinations() const;
+
+            /**
+             * @return Time and memory spent by the last Compute
+             **/
+            const Stats &GetStats() const;
+
+            /**
+             * @return Number of worker threads
+             **/
+            std::size_t GetNumThreads() const;
+    };
+}
+
+#endif // DISTANCE_TABLE_H_
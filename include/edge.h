@@ -21,15 +21,16 @@ namespace geom
     class Edge
     {
         private:
-            std::pair<std::size_t, std::size_t> m_vertices; // Store vertices ID
+            std::pair<Defs::VertexID, Defs::VertexID> m_vertices; // Store vertices ID
+            Defs::EdgeID m_id; // Edge ID (order in which the edge was added to the graph)
             uint32_t m_constructionYear; // Year in which the edge construction was completed
             uint32_t m_crossingTime; // Traversal time (cost) of the edge
             uint32_t m_buildCost; // Construction cost of the edge
             bool m_inTree; //Indicates whether the edge is part of the cut or not (is in the MST or not)
 
         public:
-            Edge(uint32_t sideA, uint32_t sideB);
-            Edge(uint32_t sideA, uint32_t sideB, uint32_t constructionYear,
+            Edge(Defs::VertexID sideA, Defs::VertexID sideB);
+            Edge(Defs::VertexID sideA, Defs::VertexID sideB, uint32_t constructionYear,
                  uint32_t crossingTime, uint32_t buildCost);
 
             ~Edge();
@@ -64,6 +65,11 @@ namespace geom
              **/
             void SetBuildCost(uint32_t newBuildCost);
 
+            /**
+             * @brief Set a new value for the edge ID
+             **/
+            void SetID(Defs::EdgeID id);
+
             /**
              * @brief Set whether the edge is in the Minimum Spanning Tree (MST) or not
              **/
@@ -90,10 +96,15 @@ namespace geom
              **/
             uint32_t GetSpecifiedCost(Defs::EDGE_INFO info) const;
 
+            /**
+             * @return Value of the edge ID
+             **/
+            Defs::EdgeID GetID();
+
             /**
              * @return std::pair<a, b>, where a, b are the vertices ID
              **/
-            std::pair<std::size_t, std::size_t> GetVertices();
+            std::pair<Defs::VertexID, Defs::VertexID> GetVertices();
 
             /**
              * @return A boolean indicating whether the edge is in the MST.
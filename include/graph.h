@@ -12,19 +12,116 @@
 #include <cstdint>
 
 #include <cmath>
+#include <iostream>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
 
+#include "arc.h"
 #include "edge.h"
+#include "arena.h"
 #include "vertex.h"
+#include "dary_heap.h"
+#include "dense_graph.h"
+#include "query_result.h"
+#include "query_workspace.h"
 #include "priority_queue_heap.h"
 
 namespace geom
 {
     class Graph
     {
+        public:
+            // Priority queue used by Dijkstra
+            enum QUEUE_TYPE { BINARY_HEAP, DARY_HEAP };
+
         private:
+            typedef QueryWorkspace::VertexEntry VertexEntry;
+            typedef QueryWorkspace::EdgeEntry EdgeEntry;
+
+            // Storage of the edges and of the adjacency lists, freed at once with the graph.
+            // Declared first so that it is destroyed after everything that points into it
+            Arena m_arena;
+
             Vector<Vertex> m_vertices; // Each vector position is the vertex ID
+            std::vector<Edge*, ArenaAllocator<Edge*>> m_edges; // Each vector position is the edge ID
+
+            // Workspaces of the queries, and the one of the queries run without a workspace
+            WorkspacePool m_workspacePool;
+            QueryWorkspace* m_defaultWorkspace;
+
             std::size_t m_numEdges; // number of edges in this graph
+            Defs::EdgeID m_numAddedEdges; // number of edges added so far (ID of the next edge)
+            std::size_t m_prefetchDistance; // adjacency entries prefetched ahead, 0 disables it
+            QUEUE_TYPE m_dijkstraQueue; // priority queue used by Dijkstra
+            bool m_wideWeights; // Whether some weights did not fit the arcs, so all are read from the edges
+
+            // Adjacency matrix engine, built on the first query of a dense graph
+            std::unique_ptr<DenseGraph> m_denseGraph;
+            bool m_denseOutdated; // Whether edges were added after the engine was built
+            std::mutex m_denseMutex; // Guards the construction of the engine
+            double m_denseThreshold; // density M/N² from which the matrix engine is used
+
+            /**
+             * @brief Compute the cost of every vertex and its edge to the parent vertex
+             * @param source The source vertex from which to calculate the shortest paths
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             * @param workspace Receives the costs and the parent edges
+             * @param minPQueue Empty queue of (cost, vertex ID) entries
+             **/
+            template<typename Queue>
+            void ShortestPaths(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace,
+                               Queue &minPQueue);
+
+            /**
+             * @brief Compute the cost of every vertex and its edge to the parent vertex with
+             *        the adjacency matrix engine
+             **/
+            void DenseShortestPaths(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace);
+
+            /**
+             * @brief Compute the edges of the MST with a heap of (cost, edge ID) entries
+             * @param workspace Receives the edges of the tree
+             **/
+            void SpanningTree(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace);
+
+            /**
+             * @brief Compute the edges of the MST with the adjacency matrix engine
+             * @param workspace Receives the edges of the tree
+             **/
+            void DenseSpanningTree(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace);
+
+            /**
+             * @return Workspace of the queries run without a workspace, acquired if needed
+             **/
+            QueryWorkspace* GetDefaultWorkspace();
+
+            /**
+             * @return The adjacency matrix engine, built if needed
+             **/
+            DenseGraph* GetDenseGraph();
+
+            /**
+             * @return True if the density M/N² reached the dense threshold
+             **/
+            bool IsDense();
+
+            /**
+             * @brief Prefetch the arc m_prefetchDistance entries ahead of position i of an
+             *        adjacency list. At the first position, the first entries are prefetched
+             **/
+            void PrefetchEdges(AdjacencyList* adjList, std::size_t i);
+
+            /**
+             * @brief Prefetch the neighbor of the arc half of m_prefetchDistance entries ahead
+             *        of position i of an adjacency list. Only done once that arc was prefetched
+             *        by PrefetchEdges at least half of the distance iterations before, not in the
+             *        burst of the first position, so reading its head is cheap
+             * @param cost Cost array of the query
+             **/
+            void PrefetchNeighbor(AdjacencyList* adjList, std::size_t i, const Vector<std::size_t> &cost);
 
         public:
             /**
@@ -41,6 +138,15 @@ namespace geom
              **/
             void AddVertex(Vertex vertex);
 
+            /**
+             * @brief Reserve the adjacency list of a vertex for its degree, so that its arcs take
+             *        a single block of the arena instead of growing block by block. Must be
+             *        called after the vertex is added
+             * @param vertexID ID of the vertex
+             * @param degree Number of edges of the vertex that will be added
+             **/
+            void ReserveDegree(Defs::VertexID vertexID, std::size_t degree);
+
             /**
              * @brief Adds a edge
              * @param vertexID ID of the vertex that will receive a neighbor
@@ -49,31 +155,142 @@ namespace geom
              * @param Traversal time (cost) of the edge
              * @param Construction cost of the edge
              **/
-            void AddEdge(std::size_t vertexID, std::size_t neighborID, uint32_t constructionYear,
+            void AddEdge(Defs::VertexID vertexID, Defs::VertexID neighborID, uint32_t constructionYear,
                          uint32_t crossingTime, uint32_t buildCost);
 
+            /**
+             * @return True if the weights of some edge did not fit the arcs (see Arc), so every
+             *         weight is read from the edges instead of the arcs
+             **/
+            bool HasWideWeights() const;
+
+            /**
+             * @param arc Arc of an adjacency list of the graph
+             * @param edgeInfo Type of the cost
+             * @return The specified cost of the edge of the arc
+             **/
+            inline uint32_t GetWeight(const Arc &arc, Defs::EDGE_INFO edgeInfo) const
+            {
+                if (this->m_wideWeights)
+                    return this->m_edges[arc.GetEdgeID()]->GetSpecifiedCost(edgeInfo);
+
+                return arc.GetWeight(edgeInfo);
+            }
+
+            /**
+             * @return Number of vertices in the graph
+             **/
+            std::size_t GetNumVertices();
+
+            /**
+             * @return Number of edges in the graph
+             **/
+            std::size_t GetNumEdges();
+
+            /**
+             * @return Number of malloc calls avoided by allocating the edges, the edge array and
+             *         the adjacency lists from the arena of the graph. None of them is freed on
+             *         its own either, the arena frees its blocks with the graph
+             **/
+            std::size_t GetNumMallocsAvoided();
+
+            /**
+             * @return Number of blocks the arena of the graph took from malloc
+             **/
+            std::size_t GetNumArenaBlocks();
+
+            /**
+             * @param vertexID ID of the vertex
+             * @return A pointer to the vertex with the given ID
+             **/
+            Vertex* GetVertex(Defs::VertexID vertexID);
+
+            /**
+             * @param vertexID ID of the vertex
+             * @return Cost of the vertex computed by the last Dijkstra run without a workspace
+             **/
+            std::size_t GetCost(Defs::VertexID vertexID);
+
+            /**
+             * @return Pool of the workspaces of the queries. A workspace acquired from it can
+             *         be passed to Dijkstra and PrimMST, and different workspaces may be used
+             *         by different threads at the same time
+             **/
+            WorkspacePool* GetWorkspacePool();
+
+            /**
+             * @brief Set how many adjacency entries ahead Dijkstra and PrimMST prefetch the
+             *        edges, and the neighbor vertices, they are about to touch. Each of them is
+             *        a pointer chase the hardware prefetcher cannot predict
+             * @param distance Number of entries ahead, 0 (default) disables prefetching
+             **/
+            void SetPrefetchDistance(std::size_t distance);
+
+            /**
+             * @brief Set the priority queue used by Dijkstra. DARY_HEAP is the 8-ary heap of
+             *        heap::DaryHeap
+             * @param queueType BINARY_HEAP or DARY_HEAP (default)
+             **/
+            void SetDijkstraQueue(QUEUE_TYPE queueType);
+
+            /**
+             * @brief Set the density M/N² from which Dijkstra and PrimMST run on an adjacency
+             *        matrix, scanning the vertices in O(N²) instead of using a heap. The matrix
+             *        takes two words per pair of vertices for each type of cost
+             * @param threshold Density from which the matrix is used (default 0.3), a value
+             *        above 1 disables it
+             **/
+            void SetDenseThreshold(double threshold);
+
             /**
              * @brief Relax the edge (u, v)
-             * @param u, v Vertices of this edge
-             * @param uv Pointer to the edge (u, v)
+             * @param u ID of the vertex the arc leaves
+             * @param uv Arc from u to v, in the adjacency list of u
              * @param edgeInfo Type of cost considered in the shortest path calculation
+             * @param workspace Workspace holding the costs of the query
              **/
-            bool Relax(Vertex* u, Vertex* v, std::shared_ptr<Edge> uv, Defs::EDGE_INFO edgeInfo);
+            bool Relax(Defs::VertexID u, const Arc &uv, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace);
 
             /**
-             * @brief Run Dijkstra's algorithm to find the shortest paths from a given source vertex
+             * @brief Run Dijkstra's algorithm to find the shortest paths from a given source
+             *        vertex, on the workspace of the graph. Not thread-safe
+             *
+             * Every engine settles the vertices by cost, and equal costs by vertex ID, and the
+             * parent of a vertex is the first arc that reached its final cost, in that order
+             * and then in the order of the adjacency list. So the heaps and the matrix engine
+             * build the same tree, and the same m_maxYear, when several paths cost the same
              * @param source The source vertex from which to calculate the shortest paths
              * @param edgeInfo Type of cost considered in the shortest path calculation
+             * @return Costs and parent edges, valid until the next query run without a workspace
              **/
-            void Dijkstra(std::size_t source, Defs::EDGE_INFO edgeInfo);
+            ShortestPathResult Dijkstra(Defs::VertexID source, Defs::EDGE_INFO edgeInfo);
+
+            /**
+             * @brief Run Dijkstra's algorithm on the given workspace
+             * @param source The source vertex from which to calculate the shortest paths
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             * @param workspace Receives the cost of each vertex and its edge to the parent
+             * @return Costs and parent edges, valid until the next query on the workspace
+             **/
+            ShortestPathResult Dijkstra(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace);
 
             /**
              * @brief Run Prim's algorithm to find Minimum Spanning Tree starting from a given
-             *        source vertex
+             *        source vertex, on the workspace of the graph. Not thread-safe
+             * @param source The source vertex from which to begin the MST calculation
+             * @param edgeInfo Type of cost considered in the MST calculation
+             * @return Edges of the tree, valid until the next query run without a workspace
+             **/
+            SpanningTreeResult PrimMST(Defs::VertexID source, Defs::EDGE_INFO edgeInfo);
+
+            /**
+             * @brief Run Prim's algorithm on the given workspace
              * @param source The source vertex from which to begin the MST calculation
              * @param edgeInfo Type of cost considered in the MST calculation
+             * @param workspace Receives the edges of the tree
+             * @return Edges of the tree, valid until the next query on the workspace
              **/
-            void PrimMST(std::size_t source, Defs::EDGE_INFO edgeInfo);
+            SpanningTreeResult PrimMST(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace);
     };
 }
 
@@ -0,0 +1,158 @@
+/*
+* Filename: interleaved_dijkstra.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef INTERLEAVED_DIJKSTRA_H_
+#define INTERLEAVED_DIJKSTRA_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "static_graph.h"
+#include "shortest_path_tree.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief Several one-to-all Dijkstras interleaved on a single core with coroutines
+     *
+     * On graphs larger than the cache, a Dijkstra spends most of its time waiting for the
+     * adjacency rows and the distances of the neighbors. Here each query is a coroutine that
+     * prefetches the data it is about to touch and then yields, so the next query runs while
+     * the memory is being fetched. With K queries in flight, up to K misses overlap.
+     **/
+    class InterleavedDijkstra
+    {
+        public:
+            /**
+             * @brief Receives the distances of a source once its query ends. They are only
+             *        valid until the consumer returns
+             **/
+            typedef std::function<void(std::size_t source, const Vector<std::size_t> &dist)> Consumer;
+
+            /**
+             * @brief Queries per second of both execution modes
+             **/
+            struct Throughput
+            {
+                double m_interleaved; // Queries per second with the queries interleaved
+                double m_sequential; // Queries per second running the queries back to back
+            };
+
+        private:
+            // Queue entry: (distance, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> Entry;
+
+            struct CompareEntry
+            {
+                bool operator()(const Entry &e1, const Entry &e2) const
+                {
+                    return e1.first < e2.first;
+                }
+            };
+
+            // Coroutine of a query. It starts suspended and is resumed by the scheduler. The
+            // task owns the coroutine and destroys it, finished or not
+            struct Task
+            {
+                struct promise_type
+                {
+                    Task get_return_object()
+                    {
+                        return Task { std::coroutine_handle<promise_type>::from_promise(*this) };
+                    }
+
+                    std::suspend_always initial_suspend() noexcept { return {}; }
+                    std::suspend_always final_suspend() noexcept { return {}; }
+                    void return_void() { }
+                    void unhandled_exception() { std::terminate(); }
+                };
+
+                std::coroutine_handle<promise_type> m_handle; // Null if there is no coroutine
+
+                Task(std::coroutine_handle<promise_type> handle = nullptr) : m_handle(handle) { }
+
+                Task(Task &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) { }
+
+                Task& operator=(Task &&other) noexcept
+                {
+                    if (this != &other)
+                    {
+                        if (this->m_handle)
+                            this->m_handle.destroy();
+
+                        this->m_handle = std::exchange(other.m_handle, nullptr);
+                    }
+
+                    return *this;
+                }
+
+                Task(const Task&) = delete;
+                Task& operator=(const Task&) = delete;
+
+                ~Task()
+                {
+                    if (this->m_handle)
+                        this->m_handle.destroy();
+                }
+            };
+
+            // State of one of the K queries in flight
+            struct Slot
+            {
+                Vector<std::size_t> m_dist; // Distances of the query
+                heap::PriorityQueue<Entry, CompareEntry> m_queue; // Queue of the query
+                std::size_t m_source; // Source of the query
+                Task m_task; // Query coroutine, without one if idle
+            };
+
+            const StaticGraph* m_graph; // Graph being searched
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the searches
+            std::vector<std::unique_ptr<Slot>> m_slots; // Queries in flight
+
+            /**
+             * @brief Dijkstra from the source of the slot, yielding after each prefetch
+             **/
+            Task Search(Slot* slot);
+
+        public:
+            /**
+             * @param graph Graph being searched
+             * @param numInFlight Number of queries interleaved (K)
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             **/
+            InterleavedDijkstra(const StaticGraph &graph, std::size_t numInFlight,
+                                Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            ~InterleavedDijkstra();
+
+            /**
+             * @brief Compute the distances from each source, K queries at a time. If the
+             *        consumer throws, the queries in flight are dropped
+             * @param sources ID of the source vertices
+             * @param consumer Function that receives the distances of each source
+             **/
+            void Run(const Vector<std::size_t> &sources, const Consumer &consumer);
+
+            /**
+             * @brief Time the sources interleaved and then back to back with ShortestPathTree
+             * @param sources ID of the source vertices
+             * @return Queries per second of both modes
+             **/
+            Throughput Benchmark(const Vector<std::size_t> &sources);
+    };
+}
+
+#endif // INTERLEAVED_DIJKSTRA_H_
@@ -0,0 +1,90 @@
+/*
+* Filename: isochrone.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef ISOCHRONE_H_
+#define ISOCHRONE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <utility>
+#include <vector>
+
+#include "static_graph.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief Vertices reachable from a source within a distance limit
+     *
+     * A Dijkstra that never queues a vertex beyond the limit, so it ends on its own once the
+     * ball around the source is settled. The vertices whose distance is written are recorded,
+     * and only they are reset before the next query, so a query costs as much as the part of
+     * the graph it touched and not O(N).
+     **/
+    class Isochrone
+    {
+        private:
+            // Queue entry: (distance, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> Entry;
+
+            struct CompareEntry
+            {
+                bool operator()(const Entry &e1, const Entry &e2) const
+                {
+                    return e1.first < e2.first;
+                }
+            };
+
+            const StaticGraph* m_graph; // Graph being searched
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the searches
+
+            Vector<std::size_t> m_dist; // Tentative distances, infinity when untouched
+            std::vector<Defs::VertexID> m_touched; // Vertices whose distance was written by the last query
+            std::vector<Defs::VertexID> m_reached; // Vertices within the limit, by increasing distance
+            heap::PriorityQueue<Entry, CompareEntry> m_queue;
+
+            /**
+             * @brief Reset the distances written by the last query
+             **/
+            void Reset();
+
+        public:
+            /**
+             * @param graph Graph being searched
+             * @param edgeInfo Type of cost considered in the searches
+             **/
+            Isochrone(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            ~Isochrone();
+
+            /**
+             * @brief Find the vertices whose distance from the source is at most the limit
+             * @param source ID of the source vertex
+             * @param limit Largest distance of the reached vertices
+             * @return The reached vertices, the source first and by increasing distance. Valid
+             *         until the next query
+             **/
+            const std::vector<Defs::VertexID> &Query(std::size_t source, std::size_t limit);
+
+            /**
+             * @return Distance of a vertex reached by the last query
+             **/
+            inline std::size_t GetDistance(std::size_t vertexID) const
+            {
+                return this->m_dist[vertexID];
+            }
+
+            /**
+             * @return Number of vertices whose distance was written by the last query, which is
+             *         what the next reset costs
+             **/
+            std::size_t GetNumTouched() const;
+    };
+}
+
+#endif // ISOCHRONE_H_
@@ -0,0 +1,114 @@
+/*
+* Filename: multi_source_simd.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef MULTI_SOURCE_SIMD_H_
+#define MULTI_SOURCE_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include "static_graph.h"
+
+namespace geom
+{
+    /**
+     * @brief Distances from 8 or 16 sources at once, with SIMD label correcting
+     *
+     * Each vertex keeps one 32-bit distance per source (lane), stored contiguously. A round
+     * scans the arcs of the active vertices and relaxes all lanes of an arc with a single
+     * vector add and min, so the adjacency is read once for all sources instead of once per
+     * Dijkstra. A vertex becomes active for the next round when any of its lanes improves,
+     * and the engine stops when no vertex is active (Bellman-Ford with a frontier).
+     *
+     * It uses 16 lanes when the CPU supports AVX-512, 8 lanes with AVX2, and a scalar loop
+     * over 8 lanes otherwise. This pays off on low-diameter graphs, where few rounds are needed.
+     **/
+    class MultiSourceSIMD
+    {
+        public:
+            static constexpr uint32_t UNREACHABLE = UINT32_MAX; // Lane value of unreachable vertices
+
+            enum KERNEL { SCALAR, AVX2, AVX512 }; // Instruction sets, from the narrowest
+
+        private:
+
+            const StaticGraph* m_graph; // Graph being searched
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the searches
+            KERNEL m_kernel; // Instruction set used to relax the arcs
+            std::size_t m_numLanes; // Sources per pass
+            bool m_saturated; // Whether a finite distance did not fit in 32 bits
+
+            Vector<uint32_t> m_dist; // m_numLanes distances per vertex
+            Vector<Defs::VertexID> m_frontier[2]; // Active vertices of the current and of the next round
+            std::size_t m_frontierSize[2]; // Number of active vertices of each round
+            std::size_t m_next; // Which of the two frontiers is the next one
+            Vector<uint8_t> m_inNextFrontier; // Whether each vertex is in the next frontier
+
+            /**
+             * @brief Add a vertex to the next frontier, if it is not there yet
+             **/
+            inline void Activate(Defs::VertexID vertexID)
+            {
+                if (not this->m_inNextFrontier[vertexID])
+                {
+                    this->m_inNextFrontier[vertexID] = true;
+                    this->m_frontier[this->m_next][this->m_frontierSize[this->m_next]++] = vertexID;
+                }
+            }
+
+            /**
+             * @brief Relax all arcs leaving a vertex, on all lanes
+             **/
+            void RelaxScalar(Defs::VertexID vertexID);
+            void RelaxAVX2(Defs::VertexID vertexID);
+            void RelaxAVX512(Defs::VertexID vertexID);
+
+        public:
+            /**
+             * @param graph Graph being searched
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             * @param maxKernel Widest instruction set to use, if the CPU supports it
+             **/
+            MultiSourceSIMD(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME,
+                            KERNEL maxKernel = AVX512);
+
+            ~MultiSourceSIMD();
+
+            /**
+             * @return Number of sources computed per pass (8 or 16)
+             **/
+            std::size_t GetNumLanes() const;
+
+            /**
+             * @return Instruction set used to relax the arcs
+             **/
+            KERNEL GetKernel() const;
+
+            /**
+             * @brief Compute the distances from up to GetNumLanes() sources
+             * @param sources ID of the sources. Source i uses lane i
+             * @param numSources Number of sources
+             * @return True if every distance fits in 32 bits. Otherwise, the saturated
+             *         distances read as unreachable and another method must be used
+             **/
+            bool Run(const std::size_t* sources, std::size_t numSources);
+
+            /**
+             * @param lane Lane of the source
+             * @param vertexID ID of the vertex
+             * @return Distance from the source of the lane to the vertex, infinity if unreachable
+             **/
+            inline std::size_t GetDistance(std::size_t lane, std::size_t vertexID) const
+            {
+                uint32_t dist = this->m_dist[vertexID * this->m_numLanes + lane];
+                return dist == UNREACHABLE ? Defs::INFINITY_VALUE : dist;
+            }
+    };
+}
+
+#endif // MULTI_SOURCE_SIMD_H_
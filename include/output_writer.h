@@ -0,0 +1,164 @@
+/*
+* Filename: output_writer.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef OUTPUT_WRITER_H_
+#define OUTPUT_WRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <iostream>
+#include <sys/uio.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace geom
+{
+    /**
+     * @brief Buffered writer of unsigned integers to a file descriptor
+     *
+     * The numbers are formatted two digits at a time from a table of the pairs "00" to "99"
+     * straight into a large buffer, which is handed to write(2) only when full or flushed.
+     * A million lines cost a handful of system calls instead of a million formatted, locked
+     * printf calls. Nothing is written until Flush, so it must not be mixed with stdio on
+     * the same descriptor without flushing both.
+     *
+     * Long arrays are formatted in parallel: the array is split into ranges, each formatted
+     * into its own buffer by a worker thread, and the buffers are written in order with a
+     * single writev(2).
+     **/
+    class OutputWriter
+    {
+        public:
+            static constexpr std::size_t DEFAULT_BUFFER_SIZE = 1 << 16;
+
+        private:
+            static constexpr std::size_t MAX_DIGITS = 20; // Digits of the largest uint64_t
+            static constexpr std::size_t MIN_RANGE_SIZE = 1 << 16; // Fewest lines formatted by a thread
+
+            static const char DIGIT_PAIRS[201]; // "00", "01", ..., "99"
+
+            int m_fd; // File descriptor written to
+            std::vector<char> m_buffer; // Formatted text not written yet
+            std::size_t m_size; // Bytes used in the buffer
+
+            std::size_t m_numThreads; // Threads that format the ranges of an array
+            std::vector<std::vector<char>> m_rangeBuffers; // Formatted text of each range
+            std::vector<std::size_t> m_rangeSizes; // Bytes used in each range buffer
+
+            /**
+             * @brief Format the decimal digits of a number
+             * @param out Receives the digits, it must have room for MAX_DIGITS characters
+             * @return Number of digits
+             **/
+            static inline std::size_t FormatUInt(uint64_t value, char* out)
+            {
+                // The digits are formatted backwards into a scratch area, two at a time
+                char digits[MAX_DIGITS];
+                char* first = digits + MAX_DIGITS;
+
+                while (value >= 100)
+                {
+                    first -= 2;
+                    memcpy(first, &DIGIT_PAIRS[(value % 100) * 2], 2);
+                    value /= 100;
+                }
+
+                if (value >= 10)
+                {
+                    first -= 2;
+                    memcpy(first, &DIGIT_PAIRS[value * 2], 2);
+                }
+                else
+                {
+                    *--first = '0' + value;
+                }
+
+                std::size_t numDigits = digits + MAX_DIGITS - first;
+                memcpy(out, first, numDigits);
+
+                return numDigits;
+            }
+
+            /**
+             * @brief Write whole buffers in order, with as few writev calls as possible
+             * @return True if every byte was written
+             **/
+            bool WriteBuffers(std::vector<struct iovec> &buffers);
+
+        public:
+            /**
+             * @param fd File descriptor written to, standard output by default
+             * @param bufferSize Bytes kept before writing
+             **/
+            OutputWriter(int fd = STDOUT_FILENO, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+            /**
+             * @brief Write what is left in the buffer
+             **/
+            ~OutputWriter();
+
+            /**
+             * @brief Append the decimal digits of a number
+             **/
+            inline void WriteUInt(uint64_t value)
+            {
+                if (this->m_size + MAX_DIGITS > this->m_buffer.size())
+                    this->Flush();
+
+                this->m_size += FormatUInt(value, &this->m_buffer[this->m_size]);
+            }
+
+            /**
+             * @brief Append a character
+             **/
+            inline void WriteChar(char c)
+            {
+                if (this->m_size == this->m_buffer.size())
+                    this->Flush();
+
+                this->m_buffer[this->m_size++] = c;
+            }
+
+            /**
+             * @brief Append a number and a line break
+             **/
+            inline void WriteLine(uint64_t value)
+            {
+                this->WriteUInt(value);
+                this->WriteChar('\n');
+            }
+
+            /**
+             * @brief Write an array of numbers, one per line. What was appended before is
+             *        written first. Arrays longer than a range are formatted in parallel
+             * @param values Numbers to write
+             * @param count Number of values
+             * @return True if every byte was written
+             **/
+            bool WriteLines(const std::size_t* values, std::size_t count);
+
+            /**
+             * @brief Set the number of threads that format the ranges of an array
+             * @param numThreads Number of threads, 0 (default) to use one per hardware thread
+             **/
+            void SetNumThreads(std::size_t numThreads);
+
+            /**
+             * @brief Write the buffer to the file descriptor and empty it
+             * @return True if every byte was written
+             **/
+            bool Flush();
+    };
+}
+
+#endif // OUTPUT_WRITER_H_
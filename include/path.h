@@ -0,0 +1,27 @@
+/*
+* Filename: path.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef PATH_H_
+#define PATH_H_
+
+#include <cstddef>
+
+#include "definitions.h"
+#include "vector.h"
+
+namespace geom
+{
+    /**
+     * @brief Answer of a point-to-point query (s, t)
+     **/
+    struct Path
+    {
+        std::size_t m_cost = Defs::INFINITY_VALUE; // Cost from s to t, infinity if t is unreachable
+        Vector<std::size_t> m_vertices; // Vertices ID from s to t (empty if t is unreachable)
+    };
+}
+
+#endif // PATH_H_
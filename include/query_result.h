@@ -0,0 +1,48 @@
+/*
+* Filename: query_result.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef QUERY_RESULT_H_
+#define QUERY_RESULT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <span>
+
+#include "edge.h"
+
+namespace geom
+{
+    /**
+     * @brief Result of a Dijkstra query on a Graph
+     *
+     * The spans point into the workspace of the query, so they are valid until the next query
+     * on that workspace.
+     **/
+    struct ShortestPathResult
+    {
+        Defs::VertexID m_source; // Source of the query
+        std::span<const std::size_t> m_distances; // Cost of each vertex, Defs::INFINITY_VALUE if unreachable
+        std::span<Edge* const> m_parentEdges; // Edge from each vertex to its parent, nullptr for the source and the unreachable ones
+        uint32_t m_maxYear; // Max construction year of the edges of the shortest path tree, 0 if it has none
+    };
+
+    /**
+     * @brief Result of a Prim query on a Graph
+     *
+     * The spans point into the workspace of the query, so they are valid until the next query
+     * on that workspace.
+     **/
+    struct SpanningTreeResult
+    {
+        std::span<Edge* const> m_edges; // Edges of the tree, in the order they were added
+        std::span<const Defs::EdgeID> m_edgeIDs; // ID of each of those edges, its 0-based input index
+        uint32_t m_bottleneckYear; // Max construction year of the edges of the tree, 0 if it has none
+        std::size_t m_totalCost; // Sum of the build costs of the edges of the tree
+    };
+}
+
+#endif // QUERY_RESULT_H_
@@ -0,0 +1,174 @@
+/*
+* Filename: query_workspace.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef QUERY_WORKSPACE_H_
+#define QUERY_WORKSPACE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "edge.h"
+#include "dary_heap.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief State of a Dijkstra or Prim query on a Graph: the queues, the cost, parent and
+     *        mark arrays, and the result buffers
+     *
+     * Every buffer keeps its storage between queries, so once a workspace has served a
+     * query of each kind, the next ones allocate nothing. The workspace counts the times
+     * one of its buffers had to grow, so this can be checked.
+     **/
+    class QueryWorkspace
+    {
+        friend class Graph;
+
+        public:
+            // Queue entry of Dijkstra: (cost, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> VertexEntry;
+
+            // Orders by cost, and equal costs by vertex ID, as the other engines settle them
+            struct CompareVertexEntry
+            {
+                bool operator()(const VertexEntry &v1, const VertexEntry &v2) const
+                {
+                    return v1.first < v2.first or (v1.first == v2.first and v1.second < v2.second);
+                }
+            };
+
+            // Queue entry of Prim: (cost of the edge, edge ID)
+            typedef heap::DaryHeap<Defs::EdgeID>::Entry EdgeEntry;
+
+        private:
+            // Indexed by the vertex ID
+            Vector<std::size_t> m_cost; // Cost of each vertex
+            Vector<Edge*> m_edge2Father; // Edge connecting each vertex to its parent
+            Vector<uint8_t> m_visited; // Mark of the vertices visited by Prim
+
+            // Indexed by the edge ID
+            Vector<uint8_t> m_inMST; // Mark of the edges added to the MST by Prim
+            std::size_t m_numEdges; // Number of edges m_inMST was sized for
+
+            heap::PriorityQueue<VertexEntry, CompareVertexEntry> m_binaryHeap; // Queue of Dijkstra
+            heap::DaryHeap<Defs::VertexID> m_vertexHeap; // Queue of Dijkstra with DARY_HEAP
+            heap::DaryHeap<Defs::EdgeID> m_edgeHeap; // Queue of Prim
+            std::vector<EdgeEntry> m_batch; // Edges of a vertex, added to the Prim queue at once
+            std::vector<Edge*> m_MST; // Edges of the last MST
+            std::vector<Defs::EdgeID> m_MSTEdgeIDs; // ID of the edges of the last MST
+
+            // Buffers of the adjacency matrix engine
+            Vector<uint64_t> m_denseKeys; // Key of each vertex during a scan
+            Vector<Defs::EdgeID> m_denseEdges; // ID of the parent edge of each vertex
+            std::vector<Defs::EdgeID> m_denseTree; // ID of the edges of the last MST
+
+            static constexpr std::size_t NUM_BUFFERS = 11; // Buffers that grow with the queries
+
+            std::size_t m_capacities[NUM_BUFFERS]; // Capacity of each growing buffer after the last query
+            std::atomic<std::size_t> m_numAllocations; // Times a buffer was allocated or had to grow
+
+            /**
+             * @brief Read the capacity of each buffer that grows with the queries
+             * @param capacities Receives NUM_BUFFERS capacities
+             **/
+            void GetCapacities(std::size_t* capacities) const;
+
+            /**
+             * @brief Size the edge marks for the given number of edges, if not sized yet
+             **/
+            void ReserveEdges(std::size_t numEdges);
+
+            /**
+             * @brief Count the buffers that grew during the query that just ended
+             **/
+            void EndQuery();
+
+        public:
+            /**
+             * @param numVertices Number of vertices of the graph
+             **/
+            QueryWorkspace(std::size_t numVertices);
+
+            ~QueryWorkspace();
+
+            /**
+             * @return Cost of the vertex computed by the last Dijkstra on this workspace
+             **/
+            std::size_t GetCost(Defs::VertexID vertexID) const;
+
+            /**
+             * @return Edge connecting the vertex to its parent in the last Dijkstra on this
+             *         workspace, nullptr for the source and the unreachable vertices
+             **/
+            Edge* GetEdgeToFather(Defs::VertexID vertexID) const;
+
+            /**
+             * @return Edges of the last MST computed on this workspace
+             **/
+            const std::vector<Edge*> &GetMST() const;
+
+            /**
+             * @return Number of times a buffer of this workspace was allocated or had to grow,
+             *         each buffer counted on its own. The storage of the binary heap belongs to
+             *         the data_structures module, which does not report it, so it is only
+             *         counted with the default DARY_HEAP queue
+             **/
+            std::size_t GetNumAllocations() const;
+    };
+
+    /**
+     * @brief Thread-safe pool of workspaces of a graph
+     *
+     * Acquire hands out a free workspace, creating one only when all of them are in use, and
+     * Release puts it back. The workspaces are kept until the pool is destroyed.
+     **/
+    class WorkspacePool
+    {
+        private:
+            std::size_t m_numVertices; // Number of vertices of the graph
+            mutable std::mutex m_mutex; // Guards the lists below
+            std::vector<std::unique_ptr<QueryWorkspace>> m_workspaces; // Every workspace created
+            std::vector<QueryWorkspace*> m_free; // Workspaces not in use
+
+        public:
+            /**
+             * @param numVertices Number of vertices of the graph
+             **/
+            WorkspacePool(std::size_t numVertices);
+
+            ~WorkspacePool();
+
+            /**
+             * @return A workspace for the exclusive use of the caller until it is released
+             **/
+            QueryWorkspace* Acquire();
+
+            /**
+             * @brief Give back a workspace obtained from Acquire
+             **/
+            void Release(QueryWorkspace* workspace);
+
+            /**
+             * @return Number of workspaces created
+             **/
+            std::size_t GetNumWorkspaces() const;
+
+            /**
+             * @return Allocations of all workspaces, GetNumAllocations() of each summed. It
+             *         stops growing once the workspaces are warm
+             **/
+            std::size_t GetNumAllocations() const;
+    };
+}
+
+#endif // QUERY_WORKSPACE_H_
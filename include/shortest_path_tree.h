@@ -0,0 +1,85 @@
+/*
+* Filename: shortest_path_tree.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef SHORTEST_PATH_TREE_H_
+#define SHORTEST_PATH_TREE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <utility>
+
+#include "static_graph.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief One-to-all Dijkstra over a StaticGraph
+     *
+     * Unlike Graph::Dijkstra, the distances and parents live in the object and not in the
+     * graph, so several trees can be computed at the same time (one object per thread) over
+     * the same read-only graph.
+     **/
+    class ShortestPathTree
+    {
+        public:
+            static constexpr Defs::EdgeID NO_ARC = std::numeric_limits<Defs::EdgeID>::max(); // Parent arc of the source and of unreached vertices
+
+        private:
+            // Queue entry: (distance, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> Entry;
+
+            struct CompareEntry
+            {
+                bool operator()(const Entry &e1, const Entry &e2) const
+                {
+                    return e1.first < e2.first;
+                }
+            };
+
+            const StaticGraph* m_graph; // Graph being searched
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the search
+
+            Vector<std::size_t> m_dist; // Distance of each vertex from the source
+            Vector<Defs::EdgeID> m_parentArc; // Arc through which each vertex was reached
+            heap::PriorityQueue<Entry, CompareEntry> m_queue;
+
+        public:
+            /**
+             * @param graph Graph being searched
+             * @param edgeInfo Type of cost considered in the shortest path calculation
+             **/
+            ShortestPathTree(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            ~ShortestPathTree();
+
+            /**
+             * @brief Compute the shortest paths from a source to every vertex
+             * @param source ID of the source vertex
+             **/
+            void Run(std::size_t source);
+
+            /**
+             * @return Distance from the source of the last run, infinity if unreachable
+             **/
+            inline std::size_t GetDistance(std::size_t vertexID) const
+            {
+                return this->m_dist[vertexID];
+            }
+
+            /**
+             * @return Arc through which the vertex was reached in the last run, or NO_ARC
+             **/
+            inline Defs::EdgeID GetParentArc(std::size_t vertexID) const
+            {
+                return this->m_parentArc[vertexID];
+            }
+    };
+}
+
+#endif // SHORTEST_PATH_TREE_H_
@@ -0,0 +1,224 @@
+/*
+* Filename: static_graph.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef STATIC_GRAPH_H_
+#define STATIC_GRAPH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <iostream>
+#include <limits>
+
+#include "arc.h"
+#include "graph.h"
+#include "vector.h"
+
+namespace geom
+{
+    /**
+     * @brief Read-only snapshot of a Graph in compressed sparse row (CSR) layout
+     *
+     * Every undirected edge {u, v} is stored as the two arcs u -> v and v -> u. The arcs
+     * leaving vertex u are in the range [FirstArc(u), FirstArc(u + 1)). Since the arcs are
+     * never modified, the snapshot can be shared by any number of query engines and threads.
+     *
+     * Each arc is an Arc record with its head, its edge ID and the weights, packed in a 64-bit
+     * word unless the build uses wide weights, so relaxing an arc reads a single record. The
+     * snapshot of a graph whose weights do not fit the arcs keeps them in a separate array.
+     *
+     * Optionally, the vertices are split into regions and each arc carries one bit per region
+     * (arc flags), packed in 64-bit words, telling whether the arc is on a shortest path to
+     * some vertex of the region. The snapshot, with its arc flags, can be saved to a binary file.
+     **/
+    class StaticGraph
+    {
+        private:
+            static constexpr uint32_t FILE_MAGIC = 0x46524753; // "SGRF"
+            static constexpr uint32_t FILE_VERSION = 4;
+            static constexpr std::size_t CACHE_LINE = 64; // Bytes per cache line, for the prefetches
+
+            std::size_t m_numVertices; // Number of vertices
+            std::size_t m_numEdges; // Number of undirected edges
+            Vector<Defs::EdgeID> m_firstArc; // Position of the first arc of each vertex (size N + 1)
+            Vector<Arc> m_arcs; // Head, edge ID and weights of each arc
+            bool m_wideWeights; // Whether the weights are read from m_weights instead of the arcs
+            Vector<uint32_t> m_weights; // Weights of each arc, at 3 * arc + Defs::EDGE_INFO, if wide
+
+            std::size_t m_numRegions; // Number of regions of the arc flags, 0 if there are no flags
+            std::size_t m_flagWords; // Number of 64-bit words of flags of each arc
+            Defs::EDGE_INFO m_flagsEdgeInfo; // Type of cost for which the arc flags were computed
+            Vector<uint32_t> m_regions; // Region of each vertex
+            Vector<uint64_t> m_arcFlags; // Flags of each arc, m_flagWords words per arc
+
+        public:
+            /**
+             * @brief Empty graph, to be filled by Load
+             **/
+            StaticGraph();
+
+            /**
+             * @brief Build the CSR snapshot of a graph
+             * @param graph Graph whose vertices and edges will be copied
+             **/
+            StaticGraph(Graph &graph);
+
+            ~StaticGraph();
+
+            /**
+             * @return Number of vertices in the graph
+             **/
+            std::size_t GetNumVertices() const;
+
+            /**
+             * @return Number of undirected edges in the graph
+             **/
+            std::size_t GetNumEdges() const;
+
+            /**
+             * @return Number of arcs in the graph (twice the number of edges)
+             **/
+            std::size_t GetNumArcs() const;
+
+            /**
+             * @return True if the weights are packed in the 64-bit words of the arcs (see Arc)
+             **/
+            bool IsPacked() const;
+
+            /**
+             * @param vertexID ID of the vertex
+             * @return Position of the first arc leaving the vertex
+             **/
+            inline Defs::EdgeID FirstArc(std::size_t vertexID) const
+            {
+                return this->m_firstArc[vertexID];
+            }
+
+            /**
+             * @param arc Arc position
+             * @return ID of the vertex the arc points to
+             **/
+            inline Defs::VertexID GetHead(std::size_t arc) const
+            {
+                return this->m_arcs[arc].GetHead();
+            }
+
+            /**
+             * @param arc Arc position
+             * @return ID of the edge from which the arc was created
+             **/
+            inline Defs::EdgeID GetEdgeID(std::size_t arc) const
+            {
+                return this->m_arcs[arc].GetEdgeID();
+            }
+
+            /**
+             * @param arc Arc position
+             * @param edgeInfo Type of the cost
+             * @return The specified cost of the arc
+             **/
+            inline uint32_t GetWeight(std::size_t arc, Defs::EDGE_INFO edgeInfo) const
+            {
+                if (this->m_wideWeights)
+                    return this->m_weights[3 * arc + edgeInfo];
+
+                return this->m_arcs[arc].GetWeight(edgeInfo);
+            }
+
+            /**
+             * @brief Hint the cache to fetch the arc range of a vertex
+             **/
+            inline void PrefetchVertex(std::size_t vertexID) const
+            {
+                __builtin_prefetch(&this->m_firstArc[vertexID]);
+            }
+
+            /**
+             * @brief Hint the cache to fetch the heads and the weights of the arcs in
+             *        [first, last), one prefetch per cache line they span
+             **/
+            inline void PrefetchArcs(std::size_t first, std::size_t last) const
+            {
+                if (first >= last)
+                    return;
+
+                // Auxiliar variables to make code most legible
+                uintptr_t line = reinterpret_cast<uintptr_t>(&this->m_arcs[first]) & ~uintptr_t(CACHE_LINE - 1);
+                uintptr_t end = reinterpret_cast<uintptr_t>(&this->m_arcs[last - 1]) + sizeof(Arc);
+
+                for (; line < end; line += CACHE_LINE)
+                    __builtin_prefetch(reinterpret_cast<const void*>(line));
+
+                if (this->m_wideWeights)
+                    __builtin_prefetch(&this->m_weights[3 * first]);
+            }
+
+            /**
+             * @brief Discard the current arc flags and allocate new ones, all cleared
+             * @param numRegions Number of regions
+             * @param edgeInfo Type of cost for which the arc flags will be computed
+             **/
+            void ResetArcFlags(std::size_t numRegions, Defs::EDGE_INFO edgeInfo);
+
+            /**
+             * @brief Set the region of a vertex
+             **/
+            void SetRegion(std::size_t vertexID, uint32_t region);
+
+            /**
+             * @return Number of regions of the arc flags, 0 if there are no flags
+             **/
+            std::size_t GetNumRegions() const;
+
+            /**
+             * @return Type of cost for which the arc flags were computed
+             **/
+            Defs::EDGE_INFO GetArcFlagsEdgeInfo() const;
+
+            /**
+             * @return Region of the vertex
+             **/
+            inline uint32_t GetRegion(std::size_t vertexID) const
+            {
+                return this->m_regions[vertexID];
+            }
+
+            /**
+             * @return Address of the first flag word of the arc
+             **/
+            inline uint64_t* GetArcFlags(std::size_t arc)
+            {
+                return &this->m_arcFlags[arc * this->m_flagWords];
+            }
+
+            /**
+             * @return True if the arc is on a shortest path to some vertex of the region
+             **/
+            inline bool HasArcFlag(std::size_t arc, uint32_t region) const
+            {
+                return (this->m_arcFlags[arc * this->m_flagWords + region / 64] >> (region % 64)) & 1;
+            }
+
+            /**
+             * @brief Save the graph, and its arc flags if any, to a binary file
+             * @param fileName Name of the file
+             * @return True if the file was written, False otherwise
+             **/
+            bool Save(const char* fileName) const;
+
+            /**
+             * @brief Load a graph previously saved with Save, by a build with the same arc layout.
+             *        The sizes are checked against the file and the arcs and regions are
+             *        validated before the graph is replaced
+             * @param fileName Name of the file
+             * @return True if the file was read, False otherwise, leaving the graph unchanged
+             **/
+            bool Load(const char* fileName);
+    };
+}
+
+#endif // STATIC_GRAPH_H_
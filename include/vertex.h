@@ -14,20 +14,22 @@
 #include <memory>
 
 #include "edge.h"
-#include "vector.h"
+#include "adjacency_list.h"
 
 namespace geom
 {
+    /**
+     * @brief Cold data of a vertex: coordinates, ID and adjacency list. The data touched on
+     *        every relaxation (cost, visited mark and parent edge) is kept by the Graph in
+     *        dense arrays indexed by the vertex ID
+     **/
     class Vertex
     {
         private:
-            bool m_visited; // Mark this vertex as visited
             double_t m_x, m_y; // Coordinates
-            std::size_t m_id; // Vertex ID
-            std::size_t m_cost; // Cost of this vertex
+            Defs::VertexID m_id; // Vertex ID
 
-            Vector<std::shared_ptr<Edge>> m_adjList; // Adjacency list
-            std::shared_ptr<Edge> m_edge2Father; // Edge connecting to the parent vertex
+            AdjacencyList m_adjList; // Adjacency list
 
         public:
             Vertex();
@@ -36,24 +38,17 @@ namespace geom
              * @brief Constructor overload
              * @param id Vertex ID
              */
-            Vertex(std::size_t m_id);
+            Vertex(Defs::VertexID m_id);
 
             /**
              * @brief Constructor overload
              * @param x, y Point coordinates
              * @param id Vertex ID
              */
-            Vertex(double_t x, double_t y, std::size_t id);
+            Vertex(double_t x, double_t y, Defs::VertexID id);
 
             ~Vertex();
 
-            // Overload operators
-            bool operator==(const Vertex &other) const;
-            bool operator<=(const Vertex &other) const;
-            bool operator>=(const Vertex &other) const;
-            bool operator<(const Vertex &other) const;
-            bool operator>(const Vertex &other) const;
-
             /**
              * @brief Set a new value for the X-coordinate
              * @param x New value of the X-coordinate
@@ -70,25 +65,7 @@ namespace geom
              * @brief Set a new value for the vertex ID
              * @param id New value for the vertex ID
              */
-            void SetID(std::size_t id);
-
-            /**
-             * @brief Set a new value for the cost
-             * @param cost New value for the cost
-             */
-            void SetCost(std::size_t cost);
-
-            /**
-             * @brief Defines if this vertex was visited
-             * @param isVisited True is this vertex was visited, False otherwise
-             */
-            void SetVisited(bool isVisited);
-
-            /**
-             * @brief Set the edge connecting to the parent vertex.
-             * @param edge A shared pointer to the edge connecting this vertex to its parent.
-             */
-            void SetEdge2Father(std::shared_ptr<Edge> edge);
+            void SetID(Defs::VertexID id);
 
             /**
              * @return Value of the X-coordinate
@@ -108,35 +85,12 @@ namespace geom
             /**
              * @return Value of the vertex ID
              */
-            std::size_t GetID();
-
-            /**
-             * @return Value of the cost
-             */
-            std::size_t GetCost() const;
-
-            /**
-             * @return A pointer to the edge connecting this vertex to its parent
-             */
-            std::shared_ptr<Edge> GetEdge2Father();
-
-            /**
-             * @return isVisited True is this vertex was visited, False otherwise
-             */
-            bool WasVisited();
+            Defs::VertexID GetID();
 
             /**
              * @return Address of the adjacency list of this vertex
              */
-            Vector<std::shared_ptr<Edge>>* GetAdjacencyList();
-
-            struct CompareVertex
-            {
-                bool operator()(const Vertex* v1, const Vertex* v2) const
-                {
-                    return v1->m_cost < v2->m_cost;
-                }
-            };
+            AdjacencyList* GetAdjacencyList();
     };
 
 }
@@ -0,0 +1,142 @@
+/*
+* Filename: voronoi_partition.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef VORONOI_PARTITION_H_
+#define VORONOI_PARTITION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "static_graph.h"
+#include "priority_queue_heap.h"
+
+namespace geom
+{
+    /**
+     * @brief Nearest facility of every vertex, in a single Dijkstra pass
+     *
+     * All facilities are seeded at distance 0, as if a super source were connected to them
+     * by 0-cost arcs, and each vertex inherits the facility label of the vertex that settles
+     * it. One pass replaces one Dijkstra per facility. When two facilities are equally close,
+     * the vertex goes to the one listed first, unless the tie is through arcs of weight 0.
+     *
+     * The integer distances are kept in a bucket queue (Dial's algorithm): a circular array
+     * with one bucket per distance, with as many buckets as the largest arc weight plus one,
+     * so a vertex is queued and dequeued in O(1). The distances of the non-empty buckets are
+     * kept in a small heap, so the pass jumps to the next of them instead of stepping through
+     * every integer distance. When the largest weight is not below the number of vertices,
+     * few vertices would share a bucket, and a binary heap of vertices is used instead.
+     **/
+    class VoronoiPartition
+    {
+        public:
+            static constexpr Defs::VertexID NO_OWNER = std::numeric_limits<Defs::VertexID>::max(); // Owner of the unreachable vertices
+            static constexpr std::size_t MAX_BUCKETS = 1 << 20; // Largest bucket array used
+
+        private:
+            // Queue entry of the heap: (distance, vertex ID)
+            typedef std::pair<std::size_t, Defs::VertexID> Entry;
+
+            struct CompareEntry
+            {
+                bool operator()(const Entry &e1, const Entry &e2) const
+                {
+                    return e1.first < e2.first;
+                }
+            };
+
+            const StaticGraph* m_graph; // Graph being partitioned
+            Defs::EDGE_INFO m_edgeInfo; // Type of cost considered in the distances
+
+            Vector<std::size_t> m_dist; // Distance of each vertex to its nearest facility
+            Vector<Defs::VertexID> m_owner; // Position of the nearest facility in the list of facilities
+            Vector<uint8_t> m_settled; // Whether the distance of each vertex is final
+
+            std::vector<std::vector<Defs::VertexID>> m_buckets; // Vertices queued by distance modulo the number of buckets
+            heap::PriorityQueue<Entry, CompareEntry> m_queue; // Queue used when there are no buckets
+            heap::PriorityQueue<std::size_t, std::less<std::size_t>> m_bucketDists; // Distance of each non-empty bucket
+
+            /**
+             * @brief Offer vertex v the facility of u, through an arc of the given distance.
+             *        Ties are broken by the position of the facility
+             * @return True if the distance of v decreased, so v must be queued again
+             **/
+            inline bool Improve(Defs::VertexID u, Defs::VertexID v, std::size_t vDist)
+            {
+                if (this->m_settled[v])
+                    return false;
+
+                if (vDist < this->m_dist[v])
+                {
+                    this->m_dist[v] = vDist;
+                    this->m_owner[v] = this->m_owner[u];
+                    return true;
+                }
+
+                // Same distance, the entry already queued is still valid
+                if (vDist == this->m_dist[v] and this->m_owner[u] < this->m_owner[v])
+                    this->m_owner[v] = this->m_owner[u];
+
+                return false;
+            }
+
+            /**
+             * @brief Propagate the seeded facilities with the bucket queue
+             **/
+            void RunBuckets(const Vector<std::size_t> &facilities);
+
+            /**
+             * @brief Propagate the seeded facilities with the binary heap
+             **/
+            void RunHeap(const Vector<std::size_t> &facilities);
+
+        public:
+            /**
+             * @param graph Graph being partitioned
+             * @param edgeInfo Type of cost considered in the distances
+             **/
+            VoronoiPartition(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME);
+
+            ~VoronoiPartition();
+
+            /**
+             * @brief Find the nearest facility of every vertex
+             * @param facilities ID of the facility vertices
+             **/
+            void Run(const Vector<std::size_t> &facilities);
+
+            /**
+             * @return True if the bucket queue is used, False if the weights are too large
+             *         compared with the number of vertices
+             **/
+            bool UsesBuckets() const;
+
+            /**
+             * @return Position, in the list given to Run, of the nearest facility of the
+             *         vertex, NO_OWNER if no facility reaches it
+             **/
+            inline Defs::VertexID GetOwner(std::size_t vertexID) const
+            {
+                return this->m_owner[vertexID];
+            }
+
+            /**
+             * @return Distance of the vertex to its nearest facility, infinity if unreachable
+             **/
+            inline std::size_t GetDistance(std::size_t vertexID) const
+            {
+                return this->m_dist[vertexID];
+            }
+    };
+}
+
+#endif // VORONOI_PARTITION_H_
@@ -0,0 +1,111 @@
+/*
+* Filename: adjacency_list.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "adjacency_list.h"
+
+namespace geom
+{
+    AdjacencyList::AdjacencyList()
+    {
+        this->m_arena = nullptr;
+        this->m_arcs = nullptr;
+        this->m_size = 0;
+        this->m_capacity = 0;
+    }
+
+    AdjacencyList::AdjacencyList(const AdjacencyList &other)
+    {
+        this->m_arena = other.m_arena;
+        this->m_arcs = nullptr;
+        this->m_size = 0;
+        this->m_capacity = 0;
+        this->Reserve(other.m_size);
+
+        for (std::size_t i = 0; i < other.m_size; i++)
+            this->PushBack(other.m_arcs[i]);
+    }
+
+    AdjacencyList &AdjacencyList::operator=(const AdjacencyList &other)
+    {
+        if (this != &other)
+        {
+            this->Release();
+            this->Reserve(other.m_size);
+
+            for (std::size_t i = 0; i < other.m_size; i++)
+                this->PushBack(other.m_arcs[i]);
+        }
+
+        return *this;
+    }
+
+    AdjacencyList::~AdjacencyList()
+    {
+        this->Release();
+    }
+
+    void AdjacencyList::Release()
+    {
+        if (this->m_arena == nullptr)
+            ::operator delete(this->m_arcs);
+
+        this->m_arcs = nullptr;
+        this->m_size = 0;
+        this->m_capacity = 0;
+    }
+
+    void AdjacencyList::Grow(uint32_t capacity)
+    {
+        Arc* arcs = nullptr;
+
+        if (this->m_arena != nullptr)
+            arcs = static_cast<Arc*>(this->m_arena->Allocate(capacity * sizeof(Arc), alignof(Arc)));
+        else
+            arcs = static_cast<Arc*>(::operator new(capacity * sizeof(Arc)));
+
+        for (std::size_t i = 0; i < this->m_size; i++)
+            new (&arcs[i]) Arc(this->m_arcs[i]);
+
+        // The old storage of an arena is abandoned, it is freed with the arena
+        if (this->m_arena == nullptr)
+            ::operator delete(this->m_arcs);
+
+        this->m_arcs = arcs;
+        this->m_capacity = capacity;
+    }
+
+    void AdjacencyList::SetArena(Arena* arena)
+    {
+        AdjacencyList arcs(*this);
+
+        this->Release();
+        this->m_arena = arena;
+        this->Reserve(arcs.Size());
+
+        for (auto &arc : arcs)
+            this->PushBack(arc);
+    }
+
+    void AdjacencyList::Reserve(std::size_t capacity)
+    {
+        if (capacity > this->m_capacity)
+            this->Grow(static_cast<uint32_t>(capacity));
+    }
+
+    void AdjacencyList::PushBack(const Arc &arc)
+    {
+        if (this->m_size == this->m_capacity)
+            this->Grow(this->m_capacity == 0 ? INITIAL_CAPACITY : 2 * this->m_capacity);
+
+        new (&this->m_arcs[this->m_size]) Arc(arc);
+        this->m_size++;
+    }
+
+    std::size_t AdjacencyList::Size() const
+    {
+        return this->m_size;
+    }
+}
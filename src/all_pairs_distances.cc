@@ -0,0 +1,233 @@
+/*
+* Filename: all_pairs_distances.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "all_pairs_distances.h"
+
+namespace geom
+{
+    AllPairsDistances::AllPairsDistances(const StaticGraph &graph, std::size_t numThreads,
+                                         Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+        this->m_numVertices = graph.GetNumVertices();
+        this->m_stride = (this->m_numVertices + BLOCK_SIZE - 1) / BLOCK_SIZE * BLOCK_SIZE;
+
+        if (numThreads == 0)
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        this->m_numThreads = numThreads;
+
+        if (__builtin_cpu_supports("avx2"))
+            this->m_minPlus = MinPlusAVX2;
+        else
+            this->m_minPlus = MinPlusScalar;
+    }
+
+    AllPairsDistances::~AllPairsDistances() { }
+
+    void AllPairsDistances::MinPlusScalar(uint64_t* c, const uint64_t* a, const uint64_t* b, std::size_t stride)
+    {
+        // Auxiliar variables to make code most legible
+        uint64_t aik, dist;
+
+        // With k in the outer loop, the tiles may be the same (a == c or b == c): row k of b
+        // and column k of a are not changed while k is used, since the diagonal is 0
+        for (std::size_t k = 0; k < BLOCK_SIZE; k++)
+        {
+            for (std::size_t i = 0; i < BLOCK_SIZE; i++)
+            {
+                aik = a[i * stride + k];
+
+                if (aik >= UNREACHABLE)
+                    continue;
+
+                for (std::size_t j = 0; j < BLOCK_SIZE; j++)
+                {
+                    dist = aik + b[k * stride + j];
+
+                    if (dist < c[i * stride + j])
+                        c[i * stride + j] = dist;
+                }
+            }
+        }
+    }
+
+    __attribute__((target("avx2")))
+    void AllPairsDistances::MinPlusAVX2(uint64_t* c, const uint64_t* a, const uint64_t* b, std::size_t stride)
+    {
+        // Auxiliar variables to make code most legible
+        __m256i aik, dist, current;
+        uint64_t* cRow = nullptr;
+        const uint64_t* bRow = nullptr;
+
+        for (std::size_t k = 0; k < BLOCK_SIZE; k++)
+        {
+            bRow = b + k * stride;
+
+            for (std::size_t i = 0; i < BLOCK_SIZE; i++)
+            {
+                if (a[i * stride + k] >= UNREACHABLE)
+                    continue;
+
+                aik = _mm256_set1_epi64x(a[i * stride + k]);
+                cRow = c + i * stride;
+
+                for (std::size_t j = 0; j < BLOCK_SIZE; j += 4)
+                {
+                    dist = _mm256_add_epi64(aik, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bRow + j)));
+                    current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cRow + j));
+                    current = _mm256_blendv_epi8(current, dist, _mm256_cmpgt_epi64(current, dist));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(cRow + j), current);
+                }
+            }
+        }
+    }
+
+    void AllPairsDistances::UpdateTiles(const std::vector<std::pair<std::size_t, std::size_t>> &tiles, std::size_t k)
+    {
+        std::atomic<std::size_t> next(0);
+
+        auto worker = [this, &tiles, &next, k]() {
+            for (std::size_t t = next++; t < tiles.size(); t = next++)
+            {
+                std::size_t i = tiles[t].first;
+                std::size_t j = tiles[t].second;
+
+                this->m_minPlus(this->Tile(i, j), this->Tile(i, k), this->Tile(k, j), this->m_stride);
+            }
+        };
+
+        std::size_t numWorkers = std::min(this->m_numThreads, tiles.size());
+
+        // The calling thread is also a worker
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < numWorkers; i++)
+            workers.emplace_back(worker);
+
+        worker();
+
+        for (auto &thread : workers)
+            thread.join();
+    }
+
+    void AllPairsDistances::Run()
+    {
+        const std::size_t stride = this->m_stride;
+        const std::size_t numBlocks = stride / BLOCK_SIZE;
+
+        this->m_dist.Resize(stride * stride);
+
+        for (std::size_t i = 0; i < stride * stride; i++)
+            this->m_dist[i] = UNREACHABLE;
+
+        // The padding vertices also get a 0 diagonal, which the kernels rely on
+        for (std::size_t i = 0; i < stride; i++)
+            this->m_dist[i * stride + i] = 0;
+
+        // Auxiliar variables to make code most legible
+        uint64_t weight;
+        Defs::VertexID head;
+
+        // Only the cheapest of the parallel arcs is kept
+        for (std::size_t u = 0; u < this->m_numVertices; u++)
+        {
+            for (Defs::EdgeID arc = this->m_graph->FirstArc(u); arc < this->m_graph->FirstArc(u + 1); arc++)
+            {
+                head = this->m_graph->GetHead(arc);
+                weight = this->m_graph->GetWeight(arc, this->m_edgeInfo);
+
+                if (weight < this->m_dist[u * stride + head])
+                    this->m_dist[u * stride + head] = weight;
+            }
+        }
+
+        std::vector<std::pair<std::size_t, std::size_t>> tiles;
+
+        for (std::size_t k = 0; k < numBlocks; k++)
+        {
+            // Paths inside block k
+            this->m_minPlus(this->Tile(k, k), this->Tile(k, k), this->Tile(k, k), stride);
+
+            // Row and column of block k, through the closed diagonal tile
+            tiles.clear();
+            for (std::size_t i = 0; i < numBlocks; i++)
+            {
+                if (i != k)
+                {
+                    tiles.push_back(std::make_pair(k, i));
+                    tiles.push_back(std::make_pair(i, k));
+                }
+            }
+
+            this->UpdateTiles(tiles, k);
+
+            // All the other tiles, through the row and the column of block k
+            tiles.clear();
+            for (std::size_t i = 0; i < numBlocks; i++)
+            {
+                for (std::size_t j = 0; j < numBlocks; j++)
+                {
+                    if (i != k and j != k)
+                        tiles.push_back(std::make_pair(i, j));
+                }
+            }
+
+            this->UpdateTiles(tiles, k);
+        }
+    }
+
+    std::size_t AllPairsDistances::GetNumVertices() const
+    {
+        return this->m_numVertices;
+    }
+
+    bool AllPairsDistances::Save(const char* fileName) const
+    {
+        if (this->m_dist.Size() != this->m_stride * this->m_stride)
+        {
+            std::cerr << "The distances must be computed by Run before being saved" << std::endl;
+            return false;
+        }
+
+        FILE* file = fopen(fileName, "wb");
+
+        if (file == nullptr)
+        {
+            std::cerr << "Could not open " << fileName << " to save the distances" << std::endl;
+            return false;
+        }
+
+        uint32_t header[3] = { FILE_MAGIC, FILE_VERSION, static_cast<uint32_t>(this->m_edgeInfo) };
+        uint64_t numVertices = this->m_numVertices;
+        bool ok = true;
+
+        ok = ok and fwrite(header, sizeof(uint32_t), 3, file) == 3;
+        ok = ok and fwrite(&numVertices, sizeof(uint64_t), 1, file) == 1;
+
+        // The rows are written without the padding
+        std::vector<uint64_t> row(numVertices);
+        uint64_t dist;
+
+        for (std::size_t u = 0; ok and u < numVertices; u++)
+        {
+            for (std::size_t v = 0; v < numVertices; v++)
+            {
+                dist = this->m_dist[u * this->m_stride + v];
+                row[v] = dist >= UNREACHABLE ? UINT64_MAX : dist;
+            }
+
+            ok = fwrite(row.data(), sizeof(uint64_t), numVertices, file) == numVertices;
+        }
+
+        ok = fclose(file) == 0 and ok;
+
+        if (not ok)
+            std::cerr << "Could not write the distances to " << fileName << std::endl;
+
+        return ok;
+    }
+}
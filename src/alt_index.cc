@@ -0,0 +1,309 @@
+/*
+* Filename: alt_index.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "alt_index.h"
+
+namespace geom
+{
+    ALTIndex::ALTIndex(const StaticGraph &graph, std::size_t numLandmarks, SELECTION selection,
+                       std::size_t numThreads, Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+        this->m_query = 0;
+
+        if (numLandmarks > graph.GetNumVertices())
+            numLandmarks = graph.GetNumVertices();
+
+        if (numThreads == 0)
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        this->m_numLandmarks = numLandmarks;
+        this->m_landmarks.Resize(numLandmarks);
+        this->m_landmarkDist.Resize(graph.GetNumVertices() * numLandmarks);
+        this->m_targetDist.Resize(numLandmarks);
+
+        this->m_dist.Resize(graph.GetNumVertices());
+        this->m_potential.Resize(graph.GetNumVertices());
+        this->m_parent.Resize(graph.GetNumVertices());
+        this->m_reached.Resize(graph.GetNumVertices());
+
+        for (std::size_t i = 0; i < graph.GetNumVertices(); i++)
+            this->m_reached[i] = 0;
+
+        if (numLandmarks == 0)
+            return;
+
+        if (selection == DEGREE)
+        {
+            this->SelectByDegree(numThreads);
+            this->ComputeDistances(0, numThreads);
+            return;
+        }
+
+        // Farthest-first: each landmark depends on the distances of the previous ones, so the
+        // Dijkstras are sequential. Each of them is also the distance column of its landmark
+        ShortestPathTree tree(graph, edgeInfo);
+        Vector<std::size_t> minDist; // Distance from each vertex to the closest landmark
+        minDist.Resize(graph.GetNumVertices());
+
+        tree.Run(0);
+        for (std::size_t v = 0; v < graph.GetNumVertices(); v++)
+            minDist[v] = Defs::INFINITY_VALUE;
+
+        std::size_t farthest;
+
+        for (std::size_t i = 0; i < numLandmarks; i++)
+        {
+            // On the first round, the farthest vertex from vertex 0
+            farthest = 0;
+            for (std::size_t v = 0; v < graph.GetNumVertices(); v++)
+            {
+                std::size_t d = i == 0 ? tree.GetDistance(v) : minDist[v];
+
+                // Unreachable vertices come first, so every component gets a landmark
+                if (d > (i == 0 ? tree.GetDistance(farthest) : minDist[farthest]))
+                    farthest = v;
+            }
+
+            this->m_landmarks[i] = farthest;
+            tree.Run(farthest);
+            this->StoreDistances(i, tree);
+
+            for (std::size_t v = 0; v < graph.GetNumVertices(); v++)
+            {
+                if (tree.GetDistance(v) < minDist[v])
+                    minDist[v] = tree.GetDistance(v);
+            }
+        }
+    }
+
+    ALTIndex::~ALTIndex() { }
+
+    void ALTIndex::SelectByDegree(std::size_t numThreads)
+    {
+        const std::size_t numVertices = this->m_graph->GetNumVertices();
+        const std::size_t k = this->m_numLandmarks;
+
+        // Candidates of each thread: the k vertices with the largest degrees in its range,
+        // sorted by decreasing degree
+        Vector<Defs::VertexID> candidates;
+        candidates.Resize(numThreads * k);
+
+        Vector<std::size_t> numCandidates;
+        numCandidates.Resize(numThreads);
+
+        auto degree = [this](Defs::VertexID v) {
+            return this->m_graph->FirstArc(v + 1) - this->m_graph->FirstArc(v);
+        };
+
+        auto selectRange = [&](std::size_t thread) {
+            Defs::VertexID* best = &candidates[thread * k];
+            std::size_t size = 0;
+
+            for (std::size_t v = thread * numVertices / numThreads;
+                 v < (thread + 1) * numVertices / numThreads; v++)
+            {
+                if (size == k and degree(v) <= degree(best[k - 1]))
+                    continue;
+
+                // Insertion into the sorted candidates
+                std::size_t pos = size < k ? size++ : k - 1;
+                for (; pos > 0 and degree(best[pos - 1]) < degree(v); pos--)
+                    best[pos] = best[pos - 1];
+
+                best[pos] = v;
+            }
+
+            numCandidates[thread] = size;
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t thread = 0; thread < numThreads; thread++)
+            workers.emplace_back(selectRange, thread);
+
+        for (auto &worker : workers)
+            worker.join();
+
+        // Merge the candidates of all threads
+        std::size_t size = 0;
+        for (std::size_t thread = 0; thread < numThreads; thread++)
+        {
+            for (std::size_t c = 0; c < numCandidates[thread]; c++)
+            {
+                Defs::VertexID v = candidates[thread * k + c];
+
+                if (size == k and degree(v) <= degree(this->m_landmarks[k - 1]))
+                    break;
+
+                std::size_t pos = size < k ? size++ : k - 1;
+                for (; pos > 0 and degree(this->m_landmarks[pos - 1]) < degree(v); pos--)
+                    this->m_landmarks[pos] = this->m_landmarks[pos - 1];
+
+                this->m_landmarks[pos] = v;
+            }
+        }
+    }
+
+    void ALTIndex::ComputeDistances(std::size_t first, std::size_t numThreads)
+    {
+        std::atomic<std::size_t> next(first);
+
+        auto worker = [this, &next]() {
+            ShortestPathTree tree(*this->m_graph, this->m_edgeInfo);
+
+            for (std::size_t i = next++; i < this->m_numLandmarks; i = next++)
+            {
+                tree.Run(this->m_landmarks[i]);
+                this->StoreDistances(i, tree);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t thread = 0; thread < std::min(numThreads, this->m_numLandmarks - first); thread++)
+            workers.emplace_back(worker);
+
+        for (auto &thread : workers)
+            thread.join();
+    }
+
+    void ALTIndex::StoreDistances(std::size_t landmark, const ShortestPathTree &tree)
+    {
+        std::size_t d;
+
+        // Saturating a distance keeps the bound valid: |min(a, M) - min(b, M)| <= |a - b|
+        for (std::size_t v = 0; v < this->m_graph->GetNumVertices(); v++)
+        {
+            d = tree.GetDistance(v);
+
+            if (d == Defs::INFINITY_VALUE)
+                this->m_landmarkDist[v * this->m_numLandmarks + landmark] = UNREACHABLE;
+            else
+                this->m_landmarkDist[v * this->m_numLandmarks + landmark] = std::min<std::size_t>(d, UNREACHABLE - 1);
+        }
+    }
+
+    std::size_t ALTIndex::Potential(std::size_t vertexID) const
+    {
+        const uint32_t* vertexDist = &this->m_landmarkDist[vertexID * this->m_numLandmarks];
+        std::size_t bound = 0;
+        uint32_t a, b;
+
+        for (std::size_t i = 0; i < this->m_numLandmarks; i++)
+        {
+            a = this->m_targetDist[i];
+            b = vertexDist[i];
+
+            // The landmark is in another component, so it says nothing about this pair
+            if (a == UNREACHABLE or b == UNREACHABLE)
+                continue;
+
+            if (a > b and a - b > bound)
+                bound = a - b;
+            else if (b > a and b - a > bound)
+                bound = b - a;
+        }
+
+        return bound;
+    }
+
+    Path ALTIndex::Query(std::size_t source, std::size_t target)
+    {
+        Path path;
+
+        this->m_query++;
+
+        // Stamps overflowed, see BidirectionalDijkstra::NewQuery
+        if (this->m_query == 0)
+        {
+            for (std::size_t i = 0; i < this->m_graph->GetNumVertices(); i++)
+                this->m_reached[i] = 0;
+
+            this->m_query = 1;
+        }
+
+        for (std::size_t i = 0; i < this->m_numLandmarks; i++)
+            this->m_targetDist[i] = this->m_landmarkDist[target * this->m_numLandmarks + i];
+
+        this->m_dist[source] = 0;
+        this->m_potential[source] = this->Potential(source);
+        this->m_parent[source] = source;
+        this->m_reached[source] = this->m_query;
+        this->m_queue.Enqueue(Entry(this->m_potential[source], source));
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        Defs::VertexID u, v;
+        std::size_t vCost;
+        bool found = false;
+
+        while (not this->m_queue.IsEmpty())
+        {
+            entry = this->m_queue.Dequeue();
+            u = entry.second;
+
+            // Outdated entry, the vertex was settled with a smaller distance
+            if (entry.first > this->m_dist[u] + this->m_potential[u])
+                continue;
+
+            // The potential is consistent, so t is final once it leaves the queue
+            if (u == target)
+            {
+                found = true;
+                break;
+            }
+
+            for (Defs::EdgeID arc = this->m_graph->FirstArc(u); arc < this->m_graph->FirstArc(u + 1); arc++)
+            {
+                v = this->m_graph->GetHead(arc);
+                vCost = this->m_dist[u] + this->m_graph->GetWeight(arc, this->m_edgeInfo);
+
+                if (this->m_reached[v] != this->m_query)
+                {
+                    this->m_reached[v] = this->m_query;
+                    this->m_potential[v] = this->Potential(v);
+                }
+                else if (vCost >= this->m_dist[v])
+                {
+                    continue;
+                }
+
+                this->m_dist[v] = vCost;
+                this->m_parent[v] = u;
+                this->m_queue.Enqueue(Entry(vCost + this->m_potential[v], v));
+            }
+        }
+
+        // Remove the entries left by the early stop
+        while (not this->m_queue.IsEmpty())
+            this->m_queue.Dequeue();
+
+        if (not found)
+            return path;
+
+        path.m_cost = this->m_dist[target];
+
+        Vector<std::size_t> reversed;
+        for (v = target; v != source; v = this->m_parent[v])
+            reversed.PushBack(v);
+        reversed.PushBack(source);
+
+        for (std::size_t i = reversed.Size(); i > 0; i--)
+            path.m_vertices.PushBack(reversed[i - 1]);
+
+        return path;
+    }
+
+    std::size_t ALTIndex::GetNumLandmarks() const
+    {
+        return this->m_numLandmarks;
+    }
+
+    std::size_t ALTIndex::GetLandmark(std::size_t i) const
+    {
+        return this->m_landmarks[i];
+    }
+}
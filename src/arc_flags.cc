@@ -0,0 +1,253 @@
+/*
+* Filename: arc_flags.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "arc_flags.h"
+
+namespace geom
+{
+    void ArcFlags::Partition(StaticGraph &graph, std::size_t numRegions)
+    {
+        const std::size_t numVertices = graph.GetNumVertices();
+        const std::size_t regionSize = (numVertices + numRegions - 1) / numRegions;
+
+        // Vertices in breadth-first order. Consecutive chunks of regionSize vertices of this
+        // order are the regions
+        Vector<Defs::VertexID> order;
+        order.Resize(numVertices);
+
+        Vector<uint8_t> visited;
+        visited.Resize(numVertices);
+        for (std::size_t i = 0; i < numVertices; i++)
+            visited[i] = false;
+
+        std::size_t head = 0, tail = 0;
+        Defs::VertexID u, v;
+
+        for (std::size_t seed = 0; seed < numVertices; seed++)
+        {
+            if (visited[seed])
+                continue;
+
+            visited[seed] = true;
+            order[tail++] = seed;
+
+            while (head < tail)
+            {
+                u = order[head];
+                graph.SetRegion(u, head / regionSize);
+                head++;
+
+                for (Defs::EdgeID arc = graph.FirstArc(u); arc < graph.FirstArc(u + 1); arc++)
+                {
+                    v = graph.GetHead(arc);
+
+                    if (not visited[v])
+                    {
+                        visited[v] = true;
+                        order[tail++] = v;
+                    }
+                }
+            }
+        }
+    }
+
+    void ArcFlags::Preprocess(StaticGraph &graph, std::size_t numRegions, std::size_t numThreads,
+                              Defs::EDGE_INFO edgeInfo)
+    {
+        const std::size_t numVertices = graph.GetNumVertices();
+
+        if (numThreads == 0)
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        numRegions = std::max<std::size_t>(1, std::min(numRegions, numVertices));
+
+        graph.ResetArcFlags(numRegions, edgeInfo);
+
+        if (numVertices == 0)
+            return;
+
+        Partition(graph, numRegions);
+
+        // Arcs inside a region and boundary vertices
+        Vector<Defs::VertexID> boundary;
+        uint32_t region;
+        bool isBoundary;
+
+        for (std::size_t u = 0; u < numVertices; u++)
+        {
+            region = graph.GetRegion(u);
+            isBoundary = false;
+
+            for (Defs::EdgeID arc = graph.FirstArc(u); arc < graph.FirstArc(u + 1); arc++)
+            {
+                if (graph.GetRegion(graph.GetHead(arc)) == region)
+                    graph.GetArcFlags(arc)[region / 64] |= uint64_t(1) << (region % 64);
+                else
+                    isBoundary = true;
+            }
+
+            if (isBoundary)
+                boundary.PushBack(u);
+        }
+
+        // One backward search per boundary vertex. Since the graph is undirected, it is a
+        // plain Dijkstra from the boundary vertex
+        std::atomic<std::size_t> next(0);
+
+        auto worker = [&graph, &boundary, &next, edgeInfo, numVertices]() {
+            ShortestPathTree tree(graph, edgeInfo);
+            std::size_t uDist, vDist;
+            uint32_t region;
+            uint64_t bit;
+
+            for (std::size_t b = next++; b < boundary.Size(); b = next++)
+            {
+                tree.Run(boundary[b]);
+                region = graph.GetRegion(boundary[b]);
+                bit = uint64_t(1) << (region % 64);
+
+                for (std::size_t u = 0; u < numVertices; u++)
+                {
+                    uDist = tree.GetDistance(u);
+                    if (uDist == Defs::INFINITY_VALUE)
+                        continue;
+
+                    for (Defs::EdgeID arc = graph.FirstArc(u); arc < graph.FirstArc(u + 1); arc++)
+                    {
+                        vDist = tree.GetDistance(graph.GetHead(arc));
+
+                        // The arc (u, v) is on a shortest path from u to the boundary vertex
+                        if (vDist != Defs::INFINITY_VALUE and uDist == vDist + graph.GetWeight(arc, edgeInfo))
+                        {
+                            std::atomic_ref<uint64_t> word(graph.GetArcFlags(arc)[region / 64]);
+
+                            if (not (word.load(std::memory_order_relaxed) & bit))
+                                word.fetch_or(bit, std::memory_order_relaxed);
+                        }
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t thread = 0; thread < std::min<std::size_t>(numThreads, boundary.Size()); thread++)
+            workers.emplace_back(worker);
+
+        for (auto &thread : workers)
+            thread.join();
+    }
+
+    ArcFlags::ArcFlags(const StaticGraph &graph)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = graph.GetArcFlagsEdgeInfo();
+        this->m_hasFlags = graph.GetNumRegions() > 0;
+        this->m_query = 0;
+
+        // Without flags, every query would read past the end of the flag array
+        if (not this->m_hasFlags)
+            std::cerr << "The graph has no arc flags, run ArcFlags::Preprocess or load a graph with flags" << std::endl;
+
+        this->m_dist.Resize(graph.GetNumVertices());
+        this->m_parent.Resize(graph.GetNumVertices());
+        this->m_reached.Resize(graph.GetNumVertices());
+
+        for (std::size_t i = 0; i < graph.GetNumVertices(); i++)
+            this->m_reached[i] = 0;
+    }
+
+    ArcFlags::~ArcFlags() { }
+
+    bool ArcFlags::HasFlags() const
+    {
+        return this->m_hasFlags;
+    }
+
+    Path ArcFlags::Query(std::size_t source, std::size_t target)
+    {
+        Path path;
+
+        if (not this->m_hasFlags)
+            return path;
+
+        this->m_query++;
+
+        // Stamps overflowed, see BidirectionalDijkstra::NewQuery
+        if (this->m_query == 0)
+        {
+            for (std::size_t i = 0; i < this->m_graph->GetNumVertices(); i++)
+                this->m_reached[i] = 0;
+
+            this->m_query = 1;
+        }
+
+        const uint32_t targetRegion = this->m_graph->GetRegion(target);
+
+        this->m_dist[source] = 0;
+        this->m_parent[source] = source;
+        this->m_reached[source] = this->m_query;
+        this->m_queue.Enqueue(Entry(0, source));
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        Defs::VertexID u, v;
+        std::size_t vCost;
+        bool found = false;
+
+        while (not this->m_queue.IsEmpty())
+        {
+            entry = this->m_queue.Dequeue();
+            u = entry.second;
+
+            // Outdated entry, the vertex was settled with a smaller distance
+            if (entry.first > this->m_dist[u])
+                continue;
+
+            if (u == target)
+            {
+                found = true;
+                break;
+            }
+
+            for (Defs::EdgeID arc = this->m_graph->FirstArc(u); arc < this->m_graph->FirstArc(u + 1); arc++)
+            {
+                // The arc is not on any shortest path into the region of t
+                if (not this->m_graph->HasArcFlag(arc, targetRegion))
+                    continue;
+
+                v = this->m_graph->GetHead(arc);
+                vCost = entry.first + this->m_graph->GetWeight(arc, this->m_edgeInfo);
+
+                if (this->m_reached[v] != this->m_query or vCost < this->m_dist[v])
+                {
+                    this->m_dist[v] = vCost;
+                    this->m_parent[v] = u;
+                    this->m_reached[v] = this->m_query;
+                    this->m_queue.Enqueue(Entry(vCost, v));
+                }
+            }
+        }
+
+        // Remove the entries left by the early stop
+        while (not this->m_queue.IsEmpty())
+            this->m_queue.Dequeue();
+
+        if (not found)
+            return path;
+
+        path.m_cost = this->m_dist[target];
+
+        Vector<std::size_t> reversed;
+        for (v = target; v != source; v = this->m_parent[v])
+            reversed.PushBack(v);
+        reversed.PushBack(source);
+
+        for (std::size_t i = reversed.Size(); i > 0; i--)
+            path.m_vertices.PushBack(reversed[i - 1]);
+
+        return path;
+    }
+}
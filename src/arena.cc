@@ -0,0 +1,93 @@
+/*
+* Filename: arena.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "arena.h"
+
+namespace geom
+{
+    Arena::Arena(std::size_t blockSize)
+    {
+        this->m_blockSize = blockSize;
+        this->m_blocks = nullptr;
+        this->m_current = nullptr;
+        this->m_end = nullptr;
+        this->m_numAllocations = 0;
+        this->m_numBlocks = 0;
+    }
+
+    Arena::~Arena()
+    {
+        Block* next = nullptr;
+
+        for (Block* block = this->m_blocks; block != nullptr; block = next)
+        {
+            next = block->m_next;
+            free(block);
+        }
+    }
+
+    char* Arena::NewBlock(std::size_t size)
+    {
+        // The header is padded so that the usable memory has the largest fundamental alignment
+        const std::size_t headerSize = (sizeof(Block) + alignof(std::max_align_t) - 1) /
+                                       alignof(std::max_align_t) * alignof(std::max_align_t);
+
+        Block* block = static_cast<Block*>(malloc(headerSize + size));
+
+        if (block == nullptr)
+            throw std::bad_alloc();
+
+        block->m_next = this->m_blocks;
+        this->m_blocks = block;
+        this->m_numBlocks++;
+
+        return reinterpret_cast<char*>(block) + headerSize;
+    }
+
+    void* Arena::Allocate(std::size_t size, std::size_t alignment)
+    {
+        this->m_numAllocations++;
+
+        // Too large to share a block, the current block is kept for the next allocations
+        if (size + alignment > this->m_blockSize)
+        {
+            uintptr_t address = reinterpret_cast<uintptr_t>(this->NewBlock(size + alignment));
+            return reinterpret_cast<void*>((address + alignment - 1) & ~(uintptr_t(alignment) - 1));
+        }
+
+        // Auxiliar variables to make code most legible
+        uintptr_t address = reinterpret_cast<uintptr_t>(this->m_current);
+        uintptr_t aligned = (address + alignment - 1) & ~(uintptr_t(alignment) - 1);
+
+        if (this->m_current == nullptr or aligned + size > reinterpret_cast<uintptr_t>(this->m_end))
+        {
+            this->m_current = this->NewBlock(this->m_blockSize);
+            this->m_end = this->m_current + this->m_blockSize;
+
+            address = reinterpret_cast<uintptr_t>(this->m_current);
+            aligned = (address + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        }
+
+        this->m_current += aligned - address + size;
+
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    std::size_t Arena::GetNumAllocations() const
+    {
+        return this->m_numAllocations;
+    }
+
+    std::size_t Arena::GetNumBlocks() const
+    {
+        return this->m_numBlocks;
+    }
+
+    std::size_t Arena::GetNumMallocsAvoided() const
+    {
+        return this->m_numAllocations - this->m_numBlocks;
+    }
+}
@@ -0,0 +1,75 @@
+/*
+* Filename: batch_shortest_paths.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "batch_shortest_paths.h"
+
+namespace geom
+{
+    BatchShortestPaths::BatchShortestPaths(const StaticGraph &graph, std::size_t numThreads,
+                                           Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+
+        if (numThreads == 0)
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        for (std::size_t i = 0; i < numThreads; i++)
+            this->m_workspaces.push_back(std::make_unique<ShortestPathTree>(graph, edgeInfo));
+    }
+
+    BatchShortestPaths::~BatchShortestPaths() { }
+
+    void BatchShortestPaths::Run(const Vector<std::size_t> &sources, const Consumer &consumer)
+    {
+        std::atomic<std::size_t> next(0);
+        std::exception_ptr error; // First exception thrown by a consumer
+        std::mutex errorMutex; // Guards error
+
+        auto worker = [&sources, &consumer, &next, &error, &errorMutex](ShortestPathTree* tree) {
+            try
+            {
+                for (std::size_t i = next++; i < sources.Size(); i = next++)
+                {
+                    tree->Run(sources[i]);
+                    consumer(sources[i], *tree);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+
+                if (not error)
+                    error = std::current_exception();
+
+                // The other workers stop after the source they are on
+                next = sources.Size();
+            }
+        };
+
+        std::size_t numWorkers = std::min(this->m_workspaces.size(), sources.Size());
+
+        // The calling thread is also a worker. The threads are joined even if starting one
+        // of them throws
+        std::vector<std::jthread> workers;
+        for (std::size_t i = 1; i < numWorkers; i++)
+            workers.emplace_back(worker, this->m_workspaces[i].get());
+
+        if (numWorkers > 0)
+            worker(this->m_workspaces[0].get());
+
+        for (auto &thread : workers)
+            thread.join();
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    std::size_t BatchShortestPaths::GetNumThreads() const
+    {
+        return this->m_workspaces.size();
+    }
+}
@@ -0,0 +1,100 @@
+/*
+* Filename: heap_bench.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <random>
+
+#include "graph.h"
+
+/**
+ * @brief Time Graph::Dijkstra with the binary heap of the data_structures module and with
+ *        the 8-ary heap of heap::DaryHeap, and that heap alone with its inlined scalar loop
+ *        and with the opt-in AVX2 kernel
+ *
+ * The graph is random, with edges between uniformly chosen vertices. Dijkstra prints its
+ * results to the standard output, which is meant to be discarded; the timings go to the
+ * standard error.
+ *
+ * Usage: heap_bench [numVertices] [numEdges]
+ **/
+int main(int argc, char *argv[])
+{
+    std::size_t numVertices = argc > 1 ? strtoull(argv[1], nullptr, 10) : 250000;
+    std::size_t numEdges = argc > 2 ? strtoull(argv[2], nullptr, 10) : 1000000;
+
+    if (numVertices < 2 or numEdges < numVertices - 1)
+    {
+        fprintf(stderr, "The graph must have at least 2 vertices and be connected\n");
+        return EXIT_FAILURE;
+    }
+
+    geom::Graph graph(numVertices, numEdges);
+
+    for (std::size_t i = 0; i < numVertices; i++)
+        graph.AddVertex(geom::Vertex(i));
+
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<uint32_t> weight(1, 100000);
+
+    // Random spanning tree, so that every vertex is reachable, then random edges
+    for (std::size_t i = 1; i < numVertices; i++)
+        graph.AddEdge(i, generator() % i, weight(generator), weight(generator), weight(generator));
+
+    for (std::size_t i = numVertices - 1; i < numEdges; i++)
+    {
+        graph.AddEdge(generator() % numVertices, generator() % numVertices, weight(generator),
+                      weight(generator), weight(generator));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    graph.SetDijkstraQueue(geom::Graph::BINARY_HEAP);
+    graph.Dijkstra(0, Defs::EDGE_INFO::TIME);
+    std::chrono::duration<double> binary = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    graph.SetDijkstraQueue(geom::Graph::DARY_HEAP);
+    graph.Dijkstra(0, Defs::EDGE_INFO::TIME);
+    std::chrono::duration<double> dary = std::chrono::steady_clock::now() - start;
+
+    fprintf(stderr, "Dijkstra: binary heap %.3f s, 8-ary heap %.3f s\n", binary.count(), dary.count());
+
+    // The heaps alone, with the insertions and removals of a Dijkstra-like workload
+    std::size_t numOperations = 4 * numEdges;
+    std::uniform_int_distribution<uint64_t> key(0, 1 << 30);
+
+    for (bool useSIMD : { false, true })
+    {
+        heap::DaryHeap<uint32_t> dHeap(useSIMD);
+        std::mt19937_64 keys(7);
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < numOperations; i++)
+        {
+            dHeap.Enqueue(heap::DaryHeap<uint32_t>::Entry(key(keys), i));
+
+            if (i % 4 == 3)
+            {
+                dHeap.Dequeue();
+                dHeap.Dequeue();
+            }
+        }
+
+        while (not dHeap.IsEmpty())
+            dHeap.Dequeue();
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        fprintf(stderr, "8-ary heap (%s): %zu insertions in %.3f s\n", useSIMD ? "AVX2" : "scalar",
+                numOperations, elapsed.count());
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,75 @@
+/*
+* Filename: interleaved_bench.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <random>
+
+#include "graph.h"
+#include "static_graph.h"
+#include "interleaved_dijkstra.h"
+
+/**
+ * @brief Queries per second of InterleavedDijkstra with several numbers of queries in flight,
+ *        against the same queries run back to back with ShortestPathTree
+ *
+ * The graph is random, with edges between uniformly chosen vertices, so that the neighbors
+ * of a vertex are spread over the whole memory and most relaxations miss the cache.
+ *
+ * Usage: interleaved_bench [numVertices] [numEdges] [numSources]
+ **/
+int main(int argc, char *argv[])
+{
+    std::size_t numVertices = argc > 1 ? strtoull(argv[1], nullptr, 10) : 250000;
+    std::size_t numEdges = argc > 2 ? strtoull(argv[2], nullptr, 10) : 1000000;
+    std::size_t numSources = argc > 3 ? strtoull(argv[3], nullptr, 10) : 16;
+
+    if (numVertices < 2 or numEdges < numVertices - 1)
+    {
+        fprintf(stderr, "The graph must have at least 2 vertices and be connected\n");
+        return EXIT_FAILURE;
+    }
+
+    geom::Graph graph(numVertices, numEdges);
+
+    for (std::size_t i = 0; i < numVertices; i++)
+        graph.AddVertex(geom::Vertex(i));
+
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<uint32_t> weight(1, 100000);
+
+    // Random spanning tree, so that every vertex is reachable, then random edges
+    for (std::size_t i = 1; i < numVertices; i++)
+        graph.AddEdge(i, generator() % i, weight(generator), weight(generator), weight(generator));
+
+    for (std::size_t i = numVertices - 1; i < numEdges; i++)
+    {
+        graph.AddEdge(generator() % numVertices, generator() % numVertices, weight(generator),
+                      weight(generator), weight(generator));
+    }
+
+    geom::StaticGraph staticGraph(graph);
+    Vector<std::size_t> sources;
+
+    for (std::size_t i = 0; i < numSources; i++)
+        sources.PushBack(generator() % numVertices);
+
+    std::size_t numInFlight[] = { 1, 2, 4, 8, 16 };
+
+    for (std::size_t k : numInFlight)
+    {
+        geom::InterleavedDijkstra engine(staticGraph, k);
+        geom::InterleavedDijkstra::Throughput throughput = engine.Benchmark(sources);
+
+        fprintf(stderr, "%2zu in flight: interleaved %.2f queries/s, sequential %.2f queries/s\n", k,
+                throughput.m_interleaved, throughput.m_sequential);
+    }
+
+    return EXIT_SUCCESS;
+}
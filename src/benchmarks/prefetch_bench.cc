@@ -0,0 +1,75 @@
+/*
+* Filename: prefetch_bench.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <random>
+
+#include "graph.h"
+
+/**
+ * @brief Time Graph::Dijkstra and Graph::PrimMST with several prefetch distances
+ *
+ * The graph is random, with edges between uniformly chosen vertices, so that the neighbors
+ * of a vertex are spread over the whole memory. With the default sizes it takes over a hundred
+ * megabytes, far more than the last level cache. The algorithms print their results to the
+ * standard output, which is meant to be discarded; the timings go to the standard error.
+ *
+ * Usage: prefetch_bench [numVertices] [numEdges]
+ **/
+int main(int argc, char *argv[])
+{
+    std::size_t numVertices = argc > 1 ? strtoull(argv[1], nullptr, 10) : 250000;
+    std::size_t numEdges = argc > 2 ? strtoull(argv[2], nullptr, 10) : 1000000;
+
+    if (numVertices < 2 or numEdges < numVertices - 1)
+    {
+        fprintf(stderr, "The graph must have at least 2 vertices and be connected\n");
+        return EXIT_FAILURE;
+    }
+
+    geom::Graph graph(numVertices, numEdges);
+
+    for (std::size_t i = 0; i < numVertices; i++)
+        graph.AddVertex(geom::Vertex(i));
+
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<uint32_t> weight(1, 100000);
+
+    // Random spanning tree, so that every vertex is reachable, then random edges
+    for (std::size_t i = 1; i < numVertices; i++)
+        graph.AddEdge(i, generator() % i, weight(generator), weight(generator), weight(generator));
+
+    for (std::size_t i = numVertices - 1; i < numEdges; i++)
+    {
+        graph.AddEdge(generator() % numVertices, generator() % numVertices, weight(generator),
+                      weight(generator), weight(generator));
+    }
+
+    std::size_t distances[] = { 0, 2, 4, 8, 16 };
+
+    for (std::size_t distance : distances)
+    {
+        graph.SetPrefetchDistance(distance);
+
+        auto start = std::chrono::steady_clock::now();
+        graph.Dijkstra(0, Defs::EDGE_INFO::TIME);
+        std::chrono::duration<double> dijkstra = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        graph.PrimMST(0, Defs::EDGE_INFO::COST);
+        std::chrono::duration<double> prim = std::chrono::steady_clock::now() - start;
+
+        fprintf(stderr, "prefetch distance %2zu: Dijkstra %.3f s, Prim %.3f s\n", distance,
+                dijkstra.count(), prim.count());
+    }
+
+    return EXIT_SUCCESS;
+}
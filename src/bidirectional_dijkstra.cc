@@ -0,0 +1,170 @@
+/*
+* Filename: bidirectional_dijkstra.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "bidirectional_dijkstra.h"
+
+namespace geom
+{
+    BidirectionalDijkstra::BidirectionalDijkstra(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+        this->m_query = 0;
+
+        for (std::size_t dir = FORWARD; dir <= BACKWARD; dir++)
+        {
+            this->m_dist[dir].Resize(graph.GetNumVertices());
+            this->m_parent[dir].Resize(graph.GetNumVertices());
+            this->m_reached[dir].Resize(graph.GetNumVertices());
+            this->m_settled[dir].Resize(graph.GetNumVertices());
+
+            for (std::size_t i = 0; i < graph.GetNumVertices(); i++)
+            {
+                this->m_reached[dir][i] = 0;
+                this->m_settled[dir][i] = 0;
+            }
+        }
+    }
+
+    BidirectionalDijkstra::~BidirectionalDijkstra() { }
+
+    void BidirectionalDijkstra::NewQuery()
+    {
+        this->m_query++;
+
+        // The stamps overflowed, so the old ones are not distinguishable from the new ones.
+        // This happens once every 2^32 queries
+        if (this->m_query == 0)
+        {
+            for (std::size_t dir = FORWARD; dir <= BACKWARD; dir++)
+            {
+                for (std::size_t i = 0; i < this->m_graph->GetNumVertices(); i++)
+                {
+                    this->m_reached[dir][i] = 0;
+                    this->m_settled[dir][i] = 0;
+                }
+            }
+
+            this->m_query = 1;
+        }
+    }
+
+    std::size_t BidirectionalDijkstra::GetDistance(DIRECTION dir, std::size_t vertexID) const
+    {
+        if (this->m_reached[dir][vertexID] != this->m_query)
+            return Defs::INFINITY_VALUE;
+
+        return this->m_dist[dir][vertexID];
+    }
+
+    void BidirectionalDijkstra::ClearQueues()
+    {
+        // Costs as much as the entries pushed by the query, not as the number of vertices
+        for (std::size_t dir = FORWARD; dir <= BACKWARD; dir++)
+        {
+            while (not this->m_queue[dir].IsEmpty())
+                this->m_queue[dir].Dequeue();
+        }
+    }
+
+    Path BidirectionalDijkstra::Query(std::size_t source, std::size_t target)
+    {
+        Path path;
+
+        this->NewQuery();
+
+        this->m_dist[FORWARD][source] = 0;
+        this->m_parent[FORWARD][source] = source;
+        this->m_reached[FORWARD][source] = this->m_query;
+        this->m_queue[FORWARD].Enqueue(Entry(0, source));
+
+        this->m_dist[BACKWARD][target] = 0;
+        this->m_parent[BACKWARD][target] = target;
+        this->m_reached[BACKWARD][target] = this->m_query;
+        this->m_queue[BACKWARD].Enqueue(Entry(0, target));
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        std::size_t u, v, uCost, vCost, otherCost;
+        std::size_t radius[2] = { 0, 0 }; // Last key settled by each search
+        std::size_t best = source == target ? 0 : Defs::INFINITY_VALUE;
+        std::size_t meeting = source;
+        DIRECTION dir = FORWARD;
+        DIRECTION other = BACKWARD;
+
+        // If one of the queues runs out, its search has settled the whole component and
+        // every s-t path was already considered
+        while (not this->m_queue[FORWARD].IsEmpty() and not this->m_queue[BACKWARD].IsEmpty())
+        {
+            // Every path not considered yet costs at least radius[FORWARD] + radius[BACKWARD]
+            if (best != Defs::INFINITY_VALUE and radius[FORWARD] + radius[BACKWARD] >= best)
+                break;
+
+            entry = this->m_queue[dir].Dequeue();
+            u = entry.second;
+            uCost = entry.first;
+
+            // Outdated entry, the vertex was settled with a smaller distance
+            if (this->m_settled[dir][u] == this->m_query)
+            {
+                std::swap(dir, other);
+                continue;
+            }
+
+            this->m_settled[dir][u] = this->m_query;
+            radius[dir] = uCost;
+
+            for (Defs::EdgeID arc = this->m_graph->FirstArc(u); arc < this->m_graph->FirstArc(u + 1); arc++)
+            {
+                v = this->m_graph->GetHead(arc);
+                vCost = uCost + this->m_graph->GetWeight(arc, this->m_edgeInfo);
+
+                if (vCost < this->GetDistance(dir, v))
+                {
+                    this->m_dist[dir][v] = vCost;
+                    this->m_parent[dir][v] = u;
+                    this->m_reached[dir][v] = this->m_query;
+                    this->m_queue[dir].Enqueue(Entry(vCost, v));
+                }
+
+                otherCost = this->GetDistance(other, v);
+
+                // The searches met at v
+                if (otherCost != Defs::INFINITY_VALUE and this->m_dist[dir][v] + otherCost < best)
+                {
+                    best = this->m_dist[dir][v] + otherCost;
+                    meeting = v;
+                }
+            }
+
+            std::swap(dir, other);
+        }
+
+        this->ClearQueues();
+
+        if (best == Defs::INFINITY_VALUE)
+            return path;
+
+        path.m_cost = best;
+
+        // Walk from the meeting vertex to s, then from the meeting vertex to t
+        Vector<std::size_t> sPart;
+        for (v = meeting; v != source; v = this->m_parent[FORWARD][v])
+            sPart.PushBack(v);
+
+        path.m_vertices.PushBack(source);
+        for (std::size_t i = sPart.Size(); i > 0; i--)
+            path.m_vertices.PushBack(sPart[i - 1]);
+
+        for (v = meeting; v != target; )
+        {
+            v = this->m_parent[BACKWARD][v];
+            path.m_vertices.PushBack(v);
+        }
+
+        return path;
+    }
+}
@@ -0,0 +1,97 @@
+/*
+* Filename: binary_result.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "binary_result.h"
+
+namespace geom
+{
+    BinaryResult::BinaryResult()
+    {
+        this->m_file = nullptr;
+        this->m_fileName = nullptr;
+        this->m_ok = false;
+    }
+
+    BinaryResult::~BinaryResult()
+    {
+        if (this->m_file != nullptr)
+            fclose(this->m_file);
+    }
+
+    void BinaryResult::Write(const uint64_t* values, std::size_t count)
+    {
+        if (not this->m_ok or count == 0)
+            return;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        this->m_ok = fwrite(values, sizeof(uint64_t), count, this->m_file) == count;
+#else
+        uint64_t value;
+
+        for (std::size_t i = 0; this->m_ok and i < count; i++)
+        {
+            value = __builtin_bswap64(values[i]);
+            this->m_ok = fwrite(&value, sizeof(uint64_t), 1, this->m_file) == 1;
+        }
+#endif
+    }
+
+    bool BinaryResult::Open(const char* fileName, std::size_t numVertices, uint32_t flags, std::size_t numMSTEdges)
+    {
+        this->m_fileName = fileName;
+        this->m_file = fopen(fileName, "wb");
+
+        if (this->m_file == nullptr)
+        {
+            std::cerr << "Could not open " << fileName << " to save the results" << std::endl;
+            return false;
+        }
+
+        // Two uint32 packed into each uint64, so the header has the same byte order
+        uint64_t header[4] = {
+            FILE_MAGIC | static_cast<uint64_t>(FILE_VERSION) << 32,
+            flags,
+            numVertices,
+            numMSTEdges
+        };
+
+        this->m_ok = true;
+        this->Write(header, 4);
+
+        return this->m_ok;
+    }
+
+    void BinaryResult::WriteDistances(const std::vector<uint64_t> &distances)
+    {
+        this->Write(distances.data(), distances.size());
+    }
+
+    void BinaryResult::WriteResults(uint64_t maxPathYear, uint64_t maxMSTYear, uint64_t mstCost)
+    {
+        uint64_t results[3] = { maxPathYear, maxMSTYear, mstCost };
+
+        this->Write(results, 3);
+    }
+
+    void BinaryResult::WriteEdges(const std::vector<uint64_t> &edges)
+    {
+        this->Write(edges.data(), edges.size());
+    }
+
+    bool BinaryResult::Close()
+    {
+        if (this->m_file == nullptr)
+            return false;
+
+        this->m_ok = fclose(this->m_file) == 0 and this->m_ok;
+        this->m_file = nullptr;
+
+        if (not this->m_ok)
+            std::cerr << "Could not write the results to " << this->m_fileName << std::endl;
+
+        return this->m_ok;
+    }
+}
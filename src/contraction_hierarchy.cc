@@ -0,0 +1,683 @@
+/*
+* Filename: contraction_hierarchy.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "contraction_hierarchy.h"
+
+namespace geom
+{
+    ContractionHierarchy::ContractionHierarchy()
+    {
+        this->m_edgeInfo = Defs::EDGE_INFO::TIME;
+        this->m_numVertices = 0;
+        this->m_query = 0;
+        this->m_numWitnessTouched = 0;
+    }
+
+    ContractionHierarchy::~ContractionHierarchy() { }
+
+    void ContractionHierarchy::InitQueryWorkspace()
+    {
+        this->m_query = 0;
+
+        for (std::size_t dir = FORWARD; dir <= BACKWARD; dir++)
+        {
+            this->m_dist[dir].Resize(this->m_numVertices);
+            this->m_parent[dir].Resize(this->m_numVertices);
+            this->m_reached[dir].Resize(this->m_numVertices);
+
+            for (std::size_t i = 0; i < this->m_numVertices; i++)
+                this->m_reached[dir][i] = 0;
+        }
+    }
+
+    void ContractionHierarchy::WitnessSearch(Defs::VertexID source, Defs::VertexID ignored, std::size_t maxDist,
+                                             std::size_t numTargets)
+    {
+        heap::PriorityQueue<Entry, CompareEntry<Entry>> minPQueue;
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        std::size_t vCost;
+        std::size_t numSettled = 0;
+
+        this->m_witnessDist[source] = 0;
+        this->m_witnessTouched[this->m_numWitnessTouched++] = source;
+        minPQueue.Enqueue(Entry(0, source));
+
+        while (not minPQueue.IsEmpty())
+        {
+            entry = minPQueue.Dequeue();
+
+            if (entry.first > this->m_witnessDist[entry.second])
+                continue;
+
+            if (entry.first > maxDist or ++numSettled > WITNESS_SETTLE_LIMIT)
+                break;
+
+            if (this->m_position[entry.second] > this->m_position[source] and --numTargets == 0)
+                break;
+
+            for (Defs::EdgeID i = 0; i < this->m_numArcs[entry.second]; i++)
+            {
+                DynamicArc &arc = this->m_arcs[entry.second][i];
+
+                if (arc.m_head == ignored)
+                    continue;
+
+                vCost = entry.first + arc.m_weight;
+
+                if (vCost < this->m_witnessDist[arc.m_head])
+                {
+                    if (this->m_witnessDist[arc.m_head] == Defs::INFINITY_VALUE)
+                        this->m_witnessTouched[this->m_numWitnessTouched++] = arc.m_head;
+
+                    this->m_witnessDist[arc.m_head] = vCost;
+                    minPQueue.Enqueue(Entry(vCost, arc.m_head));
+                }
+            }
+        }
+    }
+
+    void ContractionHierarchy::ClearWitnessSearch()
+    {
+        for (std::size_t i = 0; i < this->m_numWitnessTouched; i++)
+            this->m_witnessDist[this->m_witnessTouched[i]] = Defs::INFINITY_VALUE;
+
+        this->m_numWitnessTouched = 0;
+    }
+
+    void ContractionHierarchy::AppendArc(Defs::VertexID vertexID, const DynamicArc &arc)
+    {
+        // Slots freed by RemoveContractedArcs are reused before the list grows
+        if (this->m_numArcs[vertexID] < this->m_arcs[vertexID].Size())
+            this->m_arcs[vertexID][this->m_numArcs[vertexID]] = arc;
+        else
+            this->m_arcs[vertexID].PushBack(arc);
+
+        this->m_numArcs[vertexID]++;
+    }
+
+    void ContractionHierarchy::RemoveContractedArcs(Defs::VertexID vertexID)
+    {
+        Defs::EdgeID numLive = 0;
+
+        for (Defs::EdgeID i = 0; i < this->m_numArcs[vertexID]; i++)
+        {
+            if (not this->m_contracted[this->m_arcs[vertexID][i].m_head])
+                this->m_arcs[vertexID][numLive++] = this->m_arcs[vertexID][i];
+        }
+
+        this->m_numArcs[vertexID] = numLive;
+    }
+
+    void ContractionHierarchy::AddShortcut(Defs::VertexID u, Defs::VertexID w, std::size_t weight, Defs::VertexID middle)
+    {
+        Defs::VertexID ends[2] = { u, w };
+
+        for (std::size_t i = 0; i < 2; i++)
+        {
+            bool found = false;
+
+            for (Defs::EdgeID j = 0; j < this->m_numArcs[ends[i]]; j++)
+            {
+                DynamicArc &arc = this->m_arcs[ends[i]][j];
+
+                if (arc.m_head != ends[1 - i])
+                    continue;
+
+                if (weight < arc.m_weight)
+                {
+                    arc.m_weight = weight;
+                    arc.m_middle = middle;
+                }
+
+                found = true;
+                break;
+            }
+
+            if (not found)
+                this->AppendArc(ends[i], DynamicArc { ends[1 - i], middle, weight });
+        }
+    }
+
+    int64_t ContractionHierarchy::ContractVertex(Defs::VertexID vertexID, bool simulate)
+    {
+        // Neighbors not contracted yet, with the cheapest arc to each one
+        Vector<Defs::VertexID> neighbors;
+        Vector<std::size_t> neighborCost;
+
+        for (Defs::EdgeID i = 0; i < this->m_numArcs[vertexID]; i++)
+        {
+            DynamicArc &arc = this->m_arcs[vertexID][i];
+
+            if (this->m_position[arc.m_head] == 0)
+            {
+                neighbors.PushBack(arc.m_head);
+                neighborCost.PushBack(arc.m_weight);
+                this->m_position[arc.m_head] = neighbors.Size();
+            }
+            else if (arc.m_weight < neighborCost[this->m_position[arc.m_head] - 1])
+            {
+                neighborCost[this->m_position[arc.m_head] - 1] = arc.m_weight;
+            }
+        }
+
+        int64_t numShortcuts = 0;
+        std::size_t maxCost, viaCost;
+
+        // The graph is undirected, so each pair {u, w} is checked only from u
+        for (std::size_t i = 0; i + 1 < neighbors.Size(); i++)
+        {
+            maxCost = 0;
+            for (std::size_t j = i + 1; j < neighbors.Size(); j++)
+            {
+                if (neighborCost[i] + neighborCost[j] > maxCost)
+                    maxCost = neighborCost[i] + neighborCost[j];
+            }
+
+            this->WitnessSearch(neighbors[i], vertexID, maxCost, neighbors.Size() - i - 1);
+
+            for (std::size_t j = i + 1; j < neighbors.Size(); j++)
+            {
+                viaCost = neighborCost[i] + neighborCost[j];
+
+                // No path avoiding the vertex is as cheap as the path through it
+                if (this->m_witnessDist[neighbors[j]] > viaCost)
+                {
+                    numShortcuts++;
+
+                    if (not simulate)
+                        this->AddShortcut(neighbors[i], neighbors[j], viaCost, vertexID);
+                }
+            }
+
+            this->ClearWitnessSearch();
+        }
+
+        for (std::size_t i = 0; i < neighbors.Size(); i++)
+            this->m_position[neighbors[i]] = 0;
+
+        return numShortcuts - static_cast<int64_t>(neighbors.Size());
+    }
+
+    void ContractionHierarchy::Build(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_edgeInfo = edgeInfo;
+        this->m_numVertices = graph.GetNumVertices();
+
+        // Copy the graph into the adjacency lists that will receive the shortcuts
+        this->m_arcs.Resize(this->m_numVertices);
+        this->m_numArcs.Resize(this->m_numVertices);
+        this->m_contracted.Resize(this->m_numVertices);
+        this->m_position.Resize(this->m_numVertices);
+        this->m_witnessDist.Resize(this->m_numVertices);
+        this->m_witnessTouched.Resize(this->m_numVertices);
+        this->m_rank.Resize(this->m_numVertices);
+
+        Vector<Defs::VertexID> numContractedNeighbors;
+        numContractedNeighbors.Resize(this->m_numVertices);
+
+        for (std::size_t u = 0; u < this->m_numVertices; u++)
+        {
+            this->m_contracted[u] = false;
+            this->m_position[u] = 0;
+            this->m_witnessDist[u] = Defs::INFINITY_VALUE;
+            numContractedNeighbors[u] = 0;
+            this->m_numArcs[u] = 0;
+
+            for (Defs::EdgeID arc = graph.FirstArc(u); arc < graph.FirstArc(u + 1); arc++)
+            {
+                this->AppendArc(u, DynamicArc { graph.GetHead(arc), NO_MIDDLE,
+                                                graph.GetWeight(arc, edgeInfo) });
+            }
+        }
+
+        // Node ordering, with lazy updates: a vertex whose priority grew since it was
+        // enqueued goes back to the queue instead of being contracted
+        heap::PriorityQueue<PriorityEntry, CompareEntry<PriorityEntry>> order;
+
+        for (std::size_t u = 0; u < this->m_numVertices; u++)
+            order.Enqueue(PriorityEntry(this->ContractVertex(u, true), u));
+
+        // Auxiliar variables to make code most legible
+        PriorityEntry entry;
+        int64_t priority;
+        Defs::VertexID numContracted = 0;
+
+        while (not order.IsEmpty())
+        {
+            entry = order.Dequeue();
+
+            if (this->m_contracted[entry.second])
+                continue;
+
+            priority = this->ContractVertex(entry.second, true) + numContractedNeighbors[entry.second];
+
+            if (priority > entry.first)
+            {
+                order.Enqueue(PriorityEntry(priority, entry.second));
+                continue;
+            }
+
+            this->ContractVertex(entry.second, false);
+            this->m_contracted[entry.second] = true;
+            this->m_rank[entry.second] = numContracted++;
+
+            // The live arcs of a contracted vertex are never touched again, and are exactly
+            // its arcs to the vertices contracted after it
+            for (Defs::EdgeID i = 0; i < this->m_numArcs[entry.second]; i++)
+            {
+                numContractedNeighbors[this->m_arcs[entry.second][i].m_head]++;
+                this->RemoveContractedArcs(this->m_arcs[entry.second][i].m_head);
+            }
+        }
+
+        // Upward CSR: keep only the cheapest arc from each vertex to each higher neighbor
+        this->m_firstArc.Resize(this->m_numVertices + 1);
+        this->m_heads = Vector<Defs::VertexID>();
+        this->m_middles = Vector<Defs::VertexID>();
+        this->m_weights = Vector<std::size_t>();
+
+        std::size_t numArcs = 0;
+        for (std::size_t u = 0; u < this->m_numVertices; u++)
+        {
+            this->m_firstArc[u] = numArcs;
+
+            for (Defs::EdgeID i = 0; i < this->m_numArcs[u]; i++)
+            {
+                DynamicArc &arc = this->m_arcs[u][i];
+
+                if (this->m_position[arc.m_head] == 0)
+                {
+                    this->m_heads.PushBack(arc.m_head);
+                    this->m_middles.PushBack(arc.m_middle);
+                    this->m_weights.PushBack(arc.m_weight);
+                    this->m_position[arc.m_head] = ++numArcs - this->m_firstArc[u];
+                }
+                else if (arc.m_weight < this->m_weights[this->m_firstArc[u] + this->m_position[arc.m_head] - 1])
+                {
+                    this->m_middles[this->m_firstArc[u] + this->m_position[arc.m_head] - 1] = arc.m_middle;
+                    this->m_weights[this->m_firstArc[u] + this->m_position[arc.m_head] - 1] = arc.m_weight;
+                }
+            }
+
+            for (Defs::EdgeID arc = this->m_firstArc[u]; arc < numArcs; arc++)
+                this->m_position[this->m_heads[arc]] = 0;
+        }
+        this->m_firstArc[this->m_numVertices] = numArcs;
+
+        // The preprocessing workspace is no longer needed
+        this->m_arcs = Vector<Vector<DynamicArc>>();
+        this->m_numArcs = Vector<Defs::EdgeID>();
+        this->m_contracted = Vector<uint8_t>();
+        this->m_position = Vector<Defs::EdgeID>();
+        this->m_witnessDist = Vector<std::size_t>();
+        this->m_witnessTouched = Vector<Defs::VertexID>();
+
+        this->InitQueryWorkspace();
+    }
+
+    bool ContractionHierarchy::Save(const char* fileName) const
+    {
+        FILE* file = fopen(fileName, "wb");
+
+        if (file == nullptr)
+        {
+            std::cerr << "Could not open " << fileName << " to save the hierarchy" << std::endl;
+            return false;
+        }
+
+        // The last header word tells the width of the vertex and arc IDs of the build
+        uint32_t header[4] = { FILE_MAGIC, FILE_VERSION, static_cast<uint32_t>(this->m_edgeInfo), ID_WIDTHS };
+        uint64_t sizes[2] = { this->m_numVertices, this->m_heads.Size() };
+        bool ok = true;
+
+        ok = ok and fwrite(header, sizeof(uint32_t), 4, file) == 4;
+        ok = ok and fwrite(sizes, sizeof(uint64_t), 2, file) == 2;
+
+        if (this->m_numVertices > 0)
+        {
+            ok = ok and fwrite(&this->m_rank[0], sizeof(Defs::VertexID), sizes[0], file) == sizes[0];
+            ok = ok and fwrite(&this->m_firstArc[0], sizeof(Defs::EdgeID), sizes[0] + 1, file) == sizes[0] + 1;
+        }
+
+        if (sizes[1] > 0)
+        {
+            ok = ok and fwrite(&this->m_heads[0], sizeof(Defs::VertexID), sizes[1], file) == sizes[1];
+            ok = ok and fwrite(&this->m_middles[0], sizeof(Defs::VertexID), sizes[1], file) == sizes[1];
+            ok = ok and fwrite(&this->m_weights[0], sizeof(std::size_t), sizes[1], file) == sizes[1];
+        }
+
+        ok = fclose(file) == 0 and ok;
+
+        if (not ok)
+            std::cerr << "Could not write the hierarchy to " << fileName << std::endl;
+
+        return ok;
+    }
+
+    bool ContractionHierarchy::Load(const char* fileName, const StaticGraph &graph)
+    {
+        FILE* file = fopen(fileName, "rb");
+
+        if (file == nullptr)
+        {
+            std::cerr << "Could not open " << fileName << " to load the hierarchy" << std::endl;
+            return false;
+        }
+
+        uint32_t header[4];
+        uint64_t sizes[2];
+
+        if (fread(header, sizeof(uint32_t), 4, file) != 4 or fread(sizes, sizeof(uint64_t), 2, file) != 2 or
+            header[0] != FILE_MAGIC or header[1] != FILE_VERSION or header[2] > Defs::EDGE_INFO::COST)
+        {
+            std::cerr << fileName << " is not a contraction hierarchy file" << std::endl;
+            fclose(file);
+            return false;
+        }
+
+        if (header[3] != ID_WIDTHS)
+        {
+            std::cerr << fileName << " was saved by a build with other ID widths" << std::endl;
+            fclose(file);
+            return false;
+        }
+
+        if (sizes[0] != graph.GetNumVertices())
+        {
+            std::cerr << fileName << " has " << sizes[0] << " vertices, but the graph has "
+                      << graph.GetNumVertices() << std::endl;
+            fclose(file);
+            return false;
+        }
+
+        // The sizes are checked against the length of the file before anything is allocated
+        long headerEnd = ftell(file);
+        fseek(file, 0, SEEK_END);
+        uint64_t expected = (sizes[0] > 0 ? sizes[0] * sizeof(Defs::VertexID) + (sizes[0] + 1) * sizeof(Defs::EdgeID) : 0) +
+                            sizes[1] * (2 * sizeof(Defs::VertexID) + sizeof(std::size_t));
+
+        if (sizes[1] > std::numeric_limits<Defs::EdgeID>::max() or uint64_t(ftell(file) - headerEnd) != expected)
+        {
+            std::cerr << fileName << " is truncated or has a wrong size" << std::endl;
+            fclose(file);
+            return false;
+        }
+
+        fseek(file, headerEnd, SEEK_SET);
+
+        // Read into temporaries, so a bad file leaves the current hierarchy untouched
+        Vector<Defs::VertexID> rank, heads, middles;
+        Vector<Defs::EdgeID> firstArc;
+        Vector<std::size_t> weights;
+
+        rank.Resize(sizes[0]);
+        firstArc.Resize(sizes[0] + 1);
+        heads.Resize(sizes[1]);
+        middles.Resize(sizes[1]);
+        weights.Resize(sizes[1]);
+        firstArc[0] = 0;
+
+        bool ok = true;
+
+        if (sizes[0] > 0)
+        {
+            ok = ok and fread(&rank[0], sizeof(Defs::VertexID), sizes[0], file) == sizes[0];
+            ok = ok and fread(&firstArc[0], sizeof(Defs::EdgeID), sizes[0] + 1, file) == sizes[0] + 1;
+        }
+
+        if (sizes[1] > 0)
+        {
+            ok = ok and fread(&heads[0], sizeof(Defs::VertexID), sizes[1], file) == sizes[1];
+            ok = ok and fread(&middles[0], sizeof(Defs::VertexID), sizes[1], file) == sizes[1];
+            ok = ok and fread(&weights[0], sizeof(std::size_t), sizes[1], file) == sizes[1];
+        }
+
+        fclose(file);
+
+        if (not ok)
+        {
+            std::cerr << fileName << " is truncated" << std::endl;
+            return false;
+        }
+
+        // The ranks must be a permutation, the arc ranges must cover the arcs in order, and
+        // every arc must go up to a vertex of the graph
+        Vector<uint8_t> rankUsed;
+        rankUsed.Resize(sizes[0]);
+
+        for (std::size_t u = 0; u < sizes[0]; u++)
+            rankUsed[u] = false;
+
+        for (std::size_t u = 0; ok and u < sizes[0]; u++)
+        {
+            ok = rank[u] < sizes[0] and not rankUsed[rank[u]];
+
+            if (ok)
+                rankUsed[rank[u]] = true;
+        }
+
+        ok = ok and firstArc[0] == 0 and firstArc[sizes[0]] == sizes[1];
+
+        for (std::size_t u = 0; ok and u < sizes[0]; u++)
+        {
+            ok = firstArc[u] <= firstArc[u + 1];
+
+            for (std::size_t arc = firstArc[u]; ok and arc < firstArc[u + 1]; arc++)
+            {
+                ok = heads[arc] < sizes[0] and rank[heads[arc]] > rank[u] and
+                     (middles[arc] == NO_MIDDLE or middles[arc] < sizes[0]);
+            }
+        }
+
+        if (not ok)
+        {
+            std::cerr << fileName << " is corrupted" << std::endl;
+            return false;
+        }
+
+        this->m_edgeInfo = static_cast<Defs::EDGE_INFO>(header[2]);
+        this->m_numVertices = sizes[0];
+        this->m_rank = rank;
+        this->m_firstArc = firstArc;
+        this->m_heads = heads;
+        this->m_middles = middles;
+        this->m_weights = weights;
+
+        this->InitQueryWorkspace();
+        return true;
+    }
+
+    Defs::EdgeID ContractionHierarchy::FindArc(Defs::VertexID u, Defs::VertexID w) const
+    {
+        // Arcs are stored in the lower endpoint
+        if (this->m_rank[u] > this->m_rank[w])
+            std::swap(u, w);
+
+        Defs::EdgeID best = NO_ARC;
+        for (Defs::EdgeID arc = this->m_firstArc[u]; arc < this->m_firstArc[u + 1]; arc++)
+        {
+            if (this->m_heads[arc] == w and (best == NO_ARC or this->m_weights[arc] < this->m_weights[best]))
+                best = arc;
+        }
+
+        return best;
+    }
+
+    void ContractionHierarchy::Unpack(Defs::VertexID u, Defs::VertexID w, Vector<std::size_t> &path) const
+    {
+        Defs::EdgeID arc = this->FindArc(u, w);
+
+        // Only a corrupted hierarchy has consecutive path vertices without an arc between them
+        if (arc == NO_ARC)
+        {
+            std::cerr << "No arc between " << u << " and " << w << " in the hierarchy" << std::endl;
+            return;
+        }
+
+        Defs::VertexID middle = this->m_middles[arc];
+
+        if (middle == NO_MIDDLE)
+        {
+            path.PushBack(w);
+            return;
+        }
+
+        this->Unpack(u, middle, path);
+        this->Unpack(middle, w, path);
+    }
+
+    Path ContractionHierarchy::Query(std::size_t source, std::size_t target)
+    {
+        Path path;
+
+        this->m_query++;
+
+        // Stamps overflowed, see BidirectionalDijkstra::NewQuery
+        if (this->m_query == 0)
+        {
+            this->InitQueryWorkspace();
+            this->m_query = 1;
+        }
+
+        std::size_t ends[2] = { source, target };
+        for (std::size_t dir = FORWARD; dir <= BACKWARD; dir++)
+        {
+            this->m_dist[dir][ends[dir]] = 0;
+            this->m_parent[dir][ends[dir]] = ends[dir];
+            this->m_reached[dir][ends[dir]] = this->m_query;
+            this->m_queue[dir].Enqueue(Entry(0, ends[dir]));
+        }
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        Defs::VertexID u, v;
+        std::size_t vCost;
+        std::size_t best = Defs::INFINITY_VALUE;
+        Defs::VertexID meeting = source;
+        std::size_t dir = FORWARD;
+        bool active[2] = { true, true };
+
+        while (active[FORWARD] or active[BACKWARD])
+        {
+            if (not active[dir])
+            {
+                dir = 1 - dir;
+                continue;
+            }
+
+            if (this->m_queue[dir].IsEmpty())
+            {
+                active[dir] = false;
+                continue;
+            }
+
+            entry = this->m_queue[dir].Dequeue();
+            u = entry.second;
+
+            // A search stops when it can no longer improve the best s-t cost
+            if (entry.first >= best)
+            {
+                active[dir] = false;
+                continue;
+            }
+
+            // Outdated entry
+            if (entry.first > this->m_dist[dir][u])
+                continue;
+
+            if (this->m_reached[1 - dir][u] == this->m_query and entry.first + this->m_dist[1 - dir][u] < best)
+            {
+                best = entry.first + this->m_dist[1 - dir][u];
+                meeting = u;
+            }
+
+            for (Defs::EdgeID arc = this->m_firstArc[u]; arc < this->m_firstArc[u + 1]; arc++)
+            {
+                v = this->m_heads[arc];
+                vCost = entry.first + this->m_weights[arc];
+
+                if (this->m_reached[dir][v] != this->m_query or vCost < this->m_dist[dir][v])
+                {
+                    this->m_dist[dir][v] = vCost;
+                    this->m_parent[dir][v] = u;
+                    this->m_reached[dir][v] = this->m_query;
+                    this->m_queue[dir].Enqueue(Entry(vCost, v));
+                }
+            }
+
+            dir = 1 - dir;
+        }
+
+        for (dir = FORWARD; dir <= BACKWARD; dir++)
+        {
+            while (not this->m_queue[dir].IsEmpty())
+                this->m_queue[dir].Dequeue();
+        }
+
+        if (best == Defs::INFINITY_VALUE)
+            return path;
+
+        path.m_cost = best;
+
+        // Path in the hierarchy: s up to the meeting vertex, then down to t
+        Vector<Defs::VertexID> upPath;
+        for (v = meeting; v != source; v = this->m_parent[FORWARD][v])
+            upPath.PushBack(v);
+        upPath.PushBack(source);
+
+        path.m_vertices.PushBack(source);
+        for (std::size_t i = upPath.Size() - 1; i > 0; i--)
+            this->Unpack(upPath[i], upPath[i - 1], path.m_vertices);
+
+        for (v = meeting; v != target; v = this->m_parent[BACKWARD][v])
+            this->Unpack(v, this->m_parent[BACKWARD][v], path.m_vertices);
+
+        return path;
+    }
+
+    std::size_t ContractionHierarchy::Verify(Graph &graph, std::size_t numPairs, uint32_t seed)
+    {
+        if (graph.GetNumVertices() != this->m_numVertices)
+        {
+            std::cerr << "The hierarchy was not built from a graph with " << graph.GetNumVertices()
+                      << " vertices" << std::endl;
+            return numPairs;
+        }
+
+        if (this->m_numVertices == 0)
+            return 0;
+
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<std::size_t> vertex(0, this->m_numVertices - 1);
+        QueryWorkspace* workspace = graph.GetWorkspacePool()->Acquire();
+
+        std::size_t numMismatches = 0;
+        std::size_t s, t;
+
+        for (std::size_t i = 0; i < numPairs; i++)
+        {
+            s = vertex(generator);
+            t = vertex(generator);
+
+            if (this->Query(s, t).m_cost != graph.Dijkstra(s, this->m_edgeInfo, *workspace).m_distances[t])
+            {
+                std::cerr << "CH mismatch between " << s << " and " << t << std::endl;
+                numMismatches++;
+            }
+        }
+
+        graph.GetWorkspacePool()->Release(workspace);
+
+        return numMismatches;
+    }
+
+    std::size_t ContractionHierarchy::GetNumArcs() const
+    {
+        return this->m_heads.Size();
+    }
+}
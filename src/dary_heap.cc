@@ -0,0 +1,39 @@
+/*
+* Filename: dary_heap.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "dary_heap.h"
+
+namespace heap
+{
+    __attribute__((target("avx2")))
+    std::size_t MinOfEightAVX2(const uint64_t* keys)
+    {
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + 4));
+
+        // Lane-wise minimum of both halves, then of its two 128-bit halves and then of the
+        // two keys of each 128-bit half, so that every lane ends with the minimum
+        __m256i min = _mm256_blendv_epi8(low, high, _mm256_cmpgt_epi64(low, high));
+        __m256i swapped = _mm256_permute4x64_epi64(min, _MM_SHUFFLE(1, 0, 3, 2));
+        min = _mm256_blendv_epi8(min, swapped, _mm256_cmpgt_epi64(min, swapped));
+        swapped = _mm256_shuffle_epi32(min, _MM_SHUFFLE(1, 0, 3, 2));
+        min = _mm256_blendv_epi8(min, swapped, _mm256_cmpgt_epi64(min, swapped));
+
+        // First position holding the minimum
+        int lowMask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(low, min)));
+        int highMask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(high, min)));
+
+        return __builtin_ctz(lowMask | highMask << 4);
+    }
+
+    MinOfEight SelectMinOfEight()
+    {
+        if (__builtin_cpu_supports("avx2"))
+            return MinOfEightAVX2;
+
+        return MinOfEightScalar;
+    }
+}
@@ -0,0 +1,268 @@
+/*
+* Filename: dense_graph.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "dense_graph.h"
+#include "graph.h"
+
+namespace geom
+{
+    DenseGraph::DenseGraph(Graph &graph)
+    {
+        this->m_graph = &graph;
+        this->m_numVertices = graph.GetNumVertices();
+
+        for (std::size_t info = 0; info < 3; info++)
+            this->m_built[info] = false;
+
+        if (__builtin_cpu_supports("avx2"))
+            this->m_argMin = ArgMinAVX2;
+        else
+            this->m_argMin = ArgMinScalar;
+    }
+
+    DenseGraph::~DenseGraph() { }
+
+    void DenseGraph::BuildMatrix(Defs::EDGE_INFO edgeInfo)
+    {
+        std::lock_guard<std::mutex> lock(this->m_buildMutex);
+
+        if (this->m_built[edgeInfo])
+            return;
+
+        const std::size_t numVertices = this->m_numVertices;
+        Vector<uint32_t> &weights = this->m_weights[edgeInfo];
+        Vector<Defs::EdgeID> &edgeIDs = this->m_edgeIDs[edgeInfo];
+
+        weights.Resize(numVertices * numVertices);
+        edgeIDs.Resize(numVertices * numVertices);
+
+        for (std::size_t i = 0; i < numVertices * numVertices; i++)
+        {
+            weights[i] = NO_WEIGHT;
+            edgeIDs[i] = NO_EDGE;
+        }
+
+        // Auxiliar variables to make code most legible
+        AdjacencyList* uAdjList = nullptr;
+        Defs::VertexID v;
+        uint32_t weight;
+
+        // Only the cheapest of the parallel edges is kept
+        for (std::size_t u = 0; u < numVertices; u++)
+        {
+            uAdjList = this->m_graph->GetVertex(u)->GetAdjacencyList();
+
+            for (auto &arc : *uAdjList)
+            {
+                v = arc.GetHead();
+                weight = this->m_graph->GetWeight(arc, edgeInfo);
+
+                if (weight < weights[u * numVertices + v])
+                {
+                    weights[u * numVertices + v] = weight;
+                    edgeIDs[u * numVertices + v] = arc.GetEdgeID();
+                }
+            }
+        }
+
+        this->m_built[edgeInfo] = true;
+    }
+
+    void DenseGraph::ReserveKeys(Vector<uint64_t> &keys) const
+    {
+        std::size_t numKeys = (this->m_numVertices + 3) / 4 * 4;
+
+        if (keys.Size() != numKeys)
+        {
+            keys.Resize(numKeys);
+
+            for (std::size_t i = 0; i < numKeys; i++)
+                keys[i] = TAKEN_KEY;
+        }
+    }
+
+    std::size_t DenseGraph::ArgMinScalar(const uint64_t* keys, std::size_t size)
+    {
+        std::size_t min = 0;
+
+        for (std::size_t i = 1; i < size; i++)
+        {
+            if (keys[i] < keys[min])
+                min = i;
+        }
+
+        return min;
+    }
+
+    __attribute__((target("avx2")))
+    std::size_t DenseGraph::ArgMinAVX2(const uint64_t* keys, std::size_t size)
+    {
+        // Smallest key seen by each lane and its position
+        __m256i minKeys = _mm256_set1_epi64x(INT64_MAX);
+        __m256i minPositions = _mm256_setzero_si256();
+        __m256i positions = _mm256_setr_epi64x(0, 1, 2, 3);
+        const __m256i step = _mm256_set1_epi64x(4);
+
+        __m256i current, smaller;
+        std::size_t i = 0;
+
+        for (; i + 4 <= size; i += 4)
+        {
+            current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+            smaller = _mm256_cmpgt_epi64(minKeys, current);
+            minKeys = _mm256_blendv_epi8(minKeys, current, smaller);
+            minPositions = _mm256_blendv_epi8(minPositions, positions, smaller);
+            positions = _mm256_add_epi64(positions, step);
+        }
+
+        alignas(32) uint64_t laneKeys[4];
+        alignas(32) uint64_t lanePositions[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(laneKeys), minKeys);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanePositions), minPositions);
+
+        // Among equal keys, the first position wins, as in ArgMinScalar
+        std::size_t min = lanePositions[0];
+        uint64_t minKey = laneKeys[0];
+
+        for (std::size_t lane = 1; lane < 4; lane++)
+        {
+            if (laneKeys[lane] < minKey or (laneKeys[lane] == minKey and lanePositions[lane] < min))
+            {
+                minKey = laneKeys[lane];
+                min = lanePositions[lane];
+            }
+        }
+
+        for (; i < size; i++)
+        {
+            if (keys[i] < minKey)
+            {
+                minKey = keys[i];
+                min = i;
+            }
+        }
+
+        return min;
+    }
+
+    void DenseGraph::Dijkstra(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, Vector<uint64_t> &keyArray,
+                              Vector<std::size_t> &cost, Vector<Defs::EdgeID> &edge2Father)
+    {
+        this->BuildMatrix(edgeInfo);
+        this->ReserveKeys(keyArray);
+
+        const std::size_t numVertices = this->m_numVertices;
+        uint64_t* keys = &keyArray[0];
+
+        if (cost.Size() != numVertices)
+            cost.Resize(numVertices);
+
+        if (edge2Father.Size() != numVertices)
+            edge2Father.Resize(numVertices);
+
+        for (std::size_t i = 0; i < numVertices; i++)
+        {
+            cost[i] = Defs::INFINITY_VALUE;
+            edge2Father[i] = NO_EDGE;
+            keys[i] = UNREACHED_KEY;
+        }
+
+        keys[source] = 0;
+
+        // Auxiliar variables to make code most legible
+        const uint32_t* row = nullptr;
+        const Defs::EdgeID* rowIDs = nullptr;
+        std::size_t u, vCost;
+
+        for (std::size_t step = 0; step < numVertices; step++)
+        {
+            // Among equal costs the smallest vertex ID, the order of the heap engines
+            u = this->m_argMin(keys, keyArray.Size());
+
+            // The remaining vertices are unreachable
+            if (keys[u] >= UNREACHED_KEY)
+                break;
+
+            cost[u] = keys[u];
+            keys[u] = TAKEN_KEY;
+
+            row = &this->m_weights[edgeInfo][u * numVertices];
+            rowIDs = &this->m_edgeIDs[edgeInfo][u * numVertices];
+
+            for (std::size_t v = 0; v < numVertices; v++)
+            {
+                if (row[v] == NO_WEIGHT or keys[v] == TAKEN_KEY)
+                    continue;
+
+                vCost = cost[u] + row[v];
+
+                if (vCost < keys[v])
+                {
+                    keys[v] = vCost;
+                    edge2Father[v] = rowIDs[v];
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < numVertices; i++)
+            keys[i] = TAKEN_KEY;
+    }
+
+    void DenseGraph::PrimMST(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, Vector<uint64_t> &keyArray,
+                             Vector<Defs::EdgeID> &edge2Tree, std::vector<Defs::EdgeID> &MST)
+    {
+        this->BuildMatrix(edgeInfo);
+        this->ReserveKeys(keyArray);
+
+        const std::size_t numVertices = this->m_numVertices;
+        uint64_t* keys = &keyArray[0];
+
+        if (edge2Tree.Size() != numVertices)
+            edge2Tree.Resize(numVertices);
+
+        for (std::size_t i = 0; i < numVertices; i++)
+        {
+            edge2Tree[i] = NO_EDGE;
+            keys[i] = UNREACHED_KEY;
+        }
+
+        keys[source] = 0;
+
+        // Auxiliar variables to make code most legible
+        const uint32_t* row = nullptr;
+        const Defs::EdgeID* rowIDs = nullptr;
+        std::size_t u;
+
+        for (std::size_t step = 0; step < numVertices; step++)
+        {
+            u = this->m_argMin(keys, keyArray.Size());
+
+            // The remaining vertices are in other components
+            if (keys[u] >= UNREACHED_KEY)
+                break;
+
+            if (u != source)
+                MST.push_back(edge2Tree[u]);
+
+            keys[u] = TAKEN_KEY;
+
+            row = &this->m_weights[edgeInfo][u * numVertices];
+            rowIDs = &this->m_edgeIDs[edgeInfo][u * numVertices];
+
+            for (std::size_t v = 0; v < numVertices; v++)
+            {
+                if (row[v] != NO_WEIGHT and keys[v] != TAKEN_KEY and row[v] < keys[v])
+                {
+                    keys[v] = row[v];
+                    edge2Tree[v] = rowIDs[v];
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < numVertices; i++)
+            keys[i] = TAKEN_KEY;
+    }
+}
@@ -0,0 +1,220 @@
+/*
+* Filename: distance_table.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "distance_table.h"
+
+namespace geom
+{
+    DistanceTable::DistanceTable(const StaticGraph &graph, std::size_t numThreads, Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+        this->m_numDistinct = 0;
+        this->m_numOrigins = 0;
+        this->m_numDestinations = 0;
+        this->m_stats = Stats();
+
+        if (numThreads == 0)
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        for (std::size_t i = 0; i < numThreads; i++)
+        {
+            std::unique_ptr<Workspace> workspace = std::make_unique<Workspace>();
+
+            workspace->m_query = 0;
+            workspace->m_dist.Resize(graph.GetNumVertices());
+            workspace->m_reached.Resize(graph.GetNumVertices());
+            workspace->m_settled.Resize(graph.GetNumVertices());
+
+            for (std::size_t v = 0; v < graph.GetNumVertices(); v++)
+            {
+                workspace->m_reached[v] = 0;
+                workspace->m_settled[v] = 0;
+            }
+
+            this->m_workspaces.push_back(std::move(workspace));
+        }
+
+        this->m_isDestination.Resize(graph.GetNumVertices());
+
+        for (std::size_t v = 0; v < graph.GetNumVertices(); v++)
+            this->m_isDestination[v] = false;
+    }
+
+    DistanceTable::~DistanceTable() { }
+
+    void DistanceTable::NewQuery(Workspace* workspace)
+    {
+        workspace->m_query++;
+
+        // The stamps overflowed, so the old ones are not distinguishable from the new ones.
+        // This happens once every 2^32 searches
+        if (workspace->m_query == 0)
+        {
+            for (std::size_t v = 0; v < this->m_graph->GetNumVertices(); v++)
+            {
+                workspace->m_reached[v] = 0;
+                workspace->m_settled[v] = 0;
+            }
+
+            workspace->m_query = 1;
+        }
+    }
+
+    void DistanceTable::Search(Workspace* workspace, std::size_t origin, const Vector<std::size_t> &destinations,
+                               uint64_t* row)
+    {
+        this->NewQuery(workspace);
+
+        const uint32_t query = workspace->m_query;
+        std::size_t remaining = this->m_numDistinct;
+        std::size_t queueSize = 1;
+
+        workspace->m_dist[origin] = 0;
+        workspace->m_reached[origin] = query;
+        workspace->m_queue.Enqueue(Entry(0, origin));
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        Defs::VertexID u, v;
+        std::size_t vDist;
+
+        while (remaining > 0 and not workspace->m_queue.IsEmpty())
+        {
+            entry = workspace->m_queue.Dequeue();
+            queueSize--;
+            u = entry.second;
+
+            // Outdated entry, the vertex was settled before with a smaller distance
+            if (workspace->m_settled[u] == query)
+                continue;
+
+            workspace->m_settled[u] = query;
+            workspace->m_numSettled++;
+
+            if (this->m_isDestination[u])
+                remaining--;
+
+            for (Defs::EdgeID arc = this->m_graph->FirstArc(u); arc < this->m_graph->FirstArc(u + 1); arc++)
+            {
+                v = this->m_graph->GetHead(arc);
+                vDist = entry.first + this->m_graph->GetWeight(arc, this->m_edgeInfo);
+
+                if (workspace->m_reached[v] != query or vDist < workspace->m_dist[v])
+                {
+                    workspace->m_dist[v] = vDist;
+                    workspace->m_reached[v] = query;
+                    workspace->m_queue.Enqueue(Entry(vDist, v));
+                    queueSize++;
+                }
+            }
+
+            workspace->m_maxQueueSize = std::max(workspace->m_maxQueueSize, queueSize);
+        }
+
+        // Entries left by the early stop. Costs as much as the entries pushed by the search
+        while (not workspace->m_queue.IsEmpty())
+            workspace->m_queue.Dequeue();
+
+        for (std::size_t j = 0; j < destinations.Size(); j++)
+        {
+            v = destinations[j];
+            row[j] = workspace->m_settled[v] == query ? workspace->m_dist[v] : UNREACHABLE;
+        }
+    }
+
+    const DistanceTable::Stats &DistanceTable::Compute(const Vector<std::size_t> &origins,
+                                                       const Vector<std::size_t> &destinations)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        this->m_numOrigins = origins.Size();
+        this->m_numDestinations = destinations.Size();
+        this->m_table.Resize(this->m_numOrigins * this->m_numDestinations);
+
+        // A destination may be repeated, but it is settled only once
+        this->m_numDistinct = 0;
+        for (std::size_t j = 0; j < destinations.Size(); j++)
+        {
+            if (not this->m_isDestination[destinations[j]])
+            {
+                this->m_isDestination[destinations[j]] = true;
+                this->m_numDistinct++;
+            }
+        }
+
+        for (auto &workspace : this->m_workspaces)
+        {
+            workspace->m_numSettled = 0;
+            workspace->m_maxQueueSize = 0;
+        }
+
+        std::atomic<std::size_t> next(0);
+
+        auto worker = [this, &origins, &destinations, &next](Workspace* workspace) {
+            for (std::size_t i = next++; i < origins.Size(); i = next++)
+                this->Search(workspace, origins[i], destinations, &this->m_table[i * this->m_numDestinations]);
+        };
+
+        std::size_t numWorkers = std::min(this->m_workspaces.size(), origins.Size());
+
+        // The calling thread is also a worker
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < numWorkers; i++)
+            workers.emplace_back(worker, this->m_workspaces[i].get());
+
+        if (numWorkers > 0)
+            worker(this->m_workspaces[0].get());
+
+        for (auto &thread : workers)
+            thread.join();
+
+        for (std::size_t j = 0; j < destinations.Size(); j++)
+            this->m_isDestination[destinations[j]] = false;
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        this->m_stats.m_seconds = elapsed.count();
+        this->m_stats.m_numSettled = 0;
+        this->m_stats.m_tableBytes = this->m_table.Size() * sizeof(uint64_t);
+        this->m_stats.m_workspaceBytes = this->m_graph->GetNumVertices() * sizeof(uint8_t);
+
+        for (auto &workspace : this->m_workspaces)
+        {
+            this->m_stats.m_numSettled += workspace->m_numSettled;
+            this->m_stats.m_workspaceBytes += this->m_graph->GetNumVertices() *
+                                              (sizeof(std::size_t) + 2 * sizeof(uint32_t));
+            this->m_stats.m_workspaceBytes += workspace->m_maxQueueSize * sizeof(Entry);
+        }
+
+        return this->m_stats;
+    }
+
+    const uint64_t* DistanceTable::GetTable() const
+    {
+        return this->m_table.Size() > 0 ? &this->m_table[0] : nullptr;
+    }
+
+    std::size_t DistanceTable::GetNumOrigins() const
+    {
+        return this->m_numOrigins;
+    }
+
+    std::size_t DistanceTable::GetNumDestinations() const
+    {
+        return this->m_numDestinations;
+    }
+
+    const DistanceTable::Stats &DistanceTable::GetStats() const
+    {
+        return this->m_stats;
+    }
+
+    std::size_t DistanceTable::GetNumThreads() const
+    {
+        return this->m_workspaces.size();
+    }
+}
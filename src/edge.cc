@@ -7,17 +7,19 @@
 #include "edge.h"
 
 namespace geom {
-    Edge::Edge(uint32_t sideA, uint32_t sideB)
+    Edge::Edge(Defs::VertexID sideA, Defs::VertexID sideB)
     {
         this->m_vertices = std::make_pair(sideA, sideB);
+        this->m_id = 0;
         this->m_constructionYear = 0;
         this->m_crossingTime = 0;
         this->m_buildCost = 0;
     }
 
-    Edge::Edge(uint32_t sideA, uint32_t sideB, uint32_t constructionYear, uint32_t crossingTime, uint32_t buildCost)
+    Edge::Edge(Defs::VertexID sideA, Defs::VertexID sideB, uint32_t constructionYear, uint32_t crossingTime, uint32_t buildCost)
     {
         this->m_vertices = std::make_pair(sideA, sideB);
+        this->m_id = 0;
         this->m_constructionYear = constructionYear;
         this->m_crossingTime = crossingTime;
         this->m_buildCost = buildCost;
@@ -26,6 +28,7 @@ namespace geom {
     Edge::Edge(const Edge &other)
     {
         this->m_vertices = other.m_vertices;
+        this->m_id = other.m_id;
         this->m_constructionYear = other.m_constructionYear;
         this->m_crossingTime = other.m_crossingTime;
         this->m_buildCost = other.m_buildCost;
@@ -39,6 +42,7 @@ namespace geom {
         if (this != &other)
         {
             this->m_vertices = other.m_vertices;
+            this->m_id = other.m_id;
             this->m_constructionYear = other.m_constructionYear;
             this->m_crossingTime = other.m_crossingTime;
             this->m_buildCost = other.m_buildCost;
@@ -69,6 +73,11 @@ namespace geom {
         this->m_buildCost = newBuildCost;
     }
 
+    void Edge::SetID(Defs::EdgeID id)
+    {
+        this->m_id = id;
+    }
+
     void Edge::SetInMST(bool isInTree)
     {
         this->m_inTree = isInTree;
@@ -107,7 +116,12 @@ namespace geom {
         }
     }
 
-    std::pair<std::size_t, std::size_t> Edge::GetVertices()
+    Defs::EdgeID Edge::GetID()
+    {
+        return this->m_id;
+    }
+
+    std::pair<Defs::VertexID, Defs::VertexID> Edge::GetVertices()
     {
         return this->m_vertices;
     }
@@ -8,197 +8,435 @@
 
 namespace geom
 {
-    Graph::Graph(std::size_t numVertices, std::size_t numEdges)
+    Graph::Graph(std::size_t numVertices, std::size_t numEdges) :
+        m_edges(ArenaAllocator<Edge*>(&m_arena)), m_workspacePool(numVertices)
     {
         // Resizes the adjacency list and matrix according to the number of vertices in the
         // graph
         this->m_vertices.Resize(numVertices);
+
+        // The adjacency lists keep their arena when the vertices are assigned by AddVertex
+        for (std::size_t i = 0; i < numVertices; i++)
+            this->m_vertices[i].GetAdjacencyList()->SetArena(&this->m_arena);
+
+        // The edge array takes a single block of the arena when numEdges is right
+        this->m_edges.reserve(numEdges);
+
+        this->m_defaultWorkspace = nullptr;
         this->m_numEdges = numEdges;
+        this->m_numAddedEdges = 0;
+        this->m_prefetchDistance = 0;
+        this->m_dijkstraQueue = DARY_HEAP;
+        this->m_wideWeights = false;
+        this->m_denseOutdated = false;
+        this->m_denseThreshold = 0.3;
     }
 
-    Graph::~Graph() { }
+    Graph::~Graph()
+    {
+        if (this->m_defaultWorkspace != nullptr)
+            this->m_workspacePool.Release(this->m_defaultWorkspace);
+    }
 
     void Graph::AddVertex(Vertex newVertex)
     {
         this->m_vertices[newVertex.GetID()] = newVertex;
     }
 
-    void Graph::AddEdge(std::size_t vertexID, std::size_t neighborID, uint32_t constructionYear,
+    void Graph::ReserveDegree(Defs::VertexID vertexID, std::size_t degree)
+    {
+        this->m_vertices[vertexID].GetAdjacencyList()->Reserve(degree);
+    }
+
+    void Graph::AddEdge(Defs::VertexID vertexID, Defs::VertexID neighborID, uint32_t constructionYear,
                         uint32_t crossingTime, uint32_t buildCost)
     {
-        // Create a ptr for the edge
-        std::shared_ptr<Edge> edge = std::make_shared<Edge>(vertexID, neighborID, constructionYear, crossingTime, buildCost);
+        // The edge lives in the arena, which frees it with the graph. Its destructor does nothing
+        Edge* edge = new (this->m_arena.Allocate(sizeof(Edge), alignof(Edge)))
+                         Edge(vertexID, neighborID, constructionYear, crossingTime, buildCost);
+        edge->SetID(this->m_numAddedEdges++);
+        this->m_edges.push_back(edge);
+
+        // The matrices no longer match the edges, they are rebuilt by the next query
+        this->m_denseOutdated = true;
 
-        // Add the edge to the neighbor list of vertexID
-        this->m_vertices[vertexID].GetAdjacencyList()->PushBack(edge);
+        // From the first weight out of the range of the arcs on, every weight is read from the
+        // edges, which keep them whole, and the arcs only hold the head and the edge ID
+        if (not Arc::Fits(constructionYear, crossingTime, buildCost))
+            this->m_wideWeights = true;
+
+        if (this->m_wideWeights)
+        {
+            constructionYear = 0;
+            crossingTime = 0;
+            buildCost = 0;
+        }
+
+        // Add the arc to the neighbor to the adjacency list of vertexID, and the opposite arc
+        // to the adjacency list of neighborID
+        this->m_vertices[vertexID].GetAdjacencyList()->PushBack(
+            Arc(neighborID, edge->GetID(), constructionYear, crossingTime, buildCost));
+        this->m_vertices[neighborID].GetAdjacencyList()->PushBack(
+            Arc(vertexID, edge->GetID(), constructionYear, crossingTime, buildCost));
+    }
+
+    bool Graph::HasWideWeights() const
+    {
+        return this->m_wideWeights;
+    }
 
-        // Add the same edge to the neighbor list of neighborID
-        this->m_vertices[neighborID].GetAdjacencyList()->PushBack(edge);
+    std::size_t Graph::GetNumVertices()
+    {
+        return this->m_vertices.Size();
+    }
+
+    std::size_t Graph::GetNumEdges()
+    {
+        return this->m_numEdges;
+    }
+
+    std::size_t Graph::GetNumMallocsAvoided()
+    {
+        return this->m_arena.GetNumMallocsAvoided();
+    }
+
+    std::size_t Graph::GetNumArenaBlocks()
+    {
+        return this->m_arena.GetNumBlocks();
+    }
+
+    Vertex* Graph::GetVertex(Defs::VertexID vertexID)
+    {
+        return &this->m_vertices[vertexID];
+    }
+
+    std::size_t Graph::GetCost(Defs::VertexID vertexID)
+    {
+        return this->GetDefaultWorkspace()->GetCost(vertexID);
     }
 
-    bool Graph::Relax(Vertex *u, Vertex *v, std::shared_ptr<Edge> uv, Defs::EDGE_INFO edgeInfo)
+    QueryWorkspace* Graph::GetDefaultWorkspace()
     {
-        if (v->GetCost() > (u->GetCost() + uv->GetSpecifiedCost(edgeInfo)))
+        if (this->m_defaultWorkspace == nullptr)
+            this->m_defaultWorkspace = this->m_workspacePool.Acquire();
+
+        return this->m_defaultWorkspace;
+    }
+
+    WorkspacePool* Graph::GetWorkspacePool()
+    {
+        return &this->m_workspacePool;
+    }
+
+    void Graph::SetPrefetchDistance(std::size_t distance)
+    {
+        this->m_prefetchDistance = distance;
+    }
+
+    void Graph::SetDijkstraQueue(QUEUE_TYPE queueType)
+    {
+        this->m_dijkstraQueue = queueType;
+    }
+
+    void Graph::SetDenseThreshold(double threshold)
+    {
+        this->m_denseThreshold = threshold;
+    }
+
+    bool Graph::IsDense()
+    {
+        double numVertices = this->m_vertices.Size();
+
+        return numVertices > 0 and this->m_edges.size() >= this->m_denseThreshold * numVertices * numVertices;
+    }
+
+    void Graph::PrefetchEdges(AdjacencyList* adjList, std::size_t i)
+    {
+        std::size_t distance = this->m_prefetchDistance;
+
+        if (i == 0)
+        {
+            for (std::size_t j = 0; j < distance and j < adjList->Size(); j++)
+                __builtin_prefetch(&adjList->At(j));
+        }
+
+        if (i + distance < adjList->Size())
+            __builtin_prefetch(&adjList->At(i + distance));
+    }
+
+    void Graph::PrefetchNeighbor(AdjacencyList* adjList, std::size_t i, const Vector<std::size_t> &cost)
+    {
+        // The arc half the distance ahead went out in PrefetchEdges gap iterations ago. Its
+        // prefetch must have had time to land, otherwise reading its head stalls the loop
+        std::size_t ahead = i + this->m_prefetchDistance / 2;
+        std::size_t gap = this->m_prefetchDistance - this->m_prefetchDistance / 2;
+
+        if (this->m_prefetchDistance >= 2 and i >= gap and ahead < adjList->Size())
+            __builtin_prefetch(&cost[adjList->At(ahead).GetHead()]);
+    }
+
+    bool Graph::Relax(Defs::VertexID u, const Arc &uv, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace)
+    {
+        Vector<std::size_t> &cost = workspace.m_cost;
+        Defs::VertexID v = uv.GetHead();
+
+        if (cost[v] > (cost[u] + this->GetWeight(uv, edgeInfo)))
         {
-            v->SetCost(u->GetCost() + uv->GetSpecifiedCost(edgeInfo));
-            v->SetEdge2Father(uv); // uv and vu must be the same
+            cost[v] = cost[u] + this->GetWeight(uv, edgeInfo);
+            workspace.m_edge2Father[v] = this->m_edges[uv.GetEdgeID()]; // uv and vu are the same edge
             return true;
         }
         return false;
     }
 
-    void Graph::Dijkstra(std::size_t source, Defs::EDGE_INFO edgeInfo)
+    template<typename Queue>
+    void Graph::ShortestPaths(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace,
+                              Queue &minPQueue)
     {
-        heap::PriorityQueue<Vertex*, Vertex::CompareVertex> minPQueue;
+        Vector<std::size_t> &cost = workspace.m_cost;
 
         // Initialize all vertex costs to infinity
-        // Add all vertices to the priority queue
         for (std::size_t i = 0; i < this->m_vertices.Size(); i++)
         {
-            if (i != source)
-                this->m_vertices[i].SetCost(Defs::INFINITY_VALUE);
-
-            this->m_vertices[i].SetEdge2Father(nullptr);
+            cost[i] = Defs::INFINITY_VALUE;
+            workspace.m_edge2Father[i] = nullptr;
         }
 
-        this->m_vertices[source].SetCost(0);
-        minPQueue.Enqueue(&this->m_vertices[source]);
+        cost[source] = 0;
+        minPQueue.Enqueue(VertexEntry(0, source));
 
         // Auxiliar variables to make code most legible
-        Vertex* u = nullptr;
-        Vertex* v = nullptr;
-        uint32_t maxEdgeConstructionYear = 0;
-        std::pair<std::size_t, std::size_t> uv;
+        VertexEntry entry;
+        Defs::VertexID u, v;
 
-        Vector<std::shared_ptr<Edge>>* uAdjList = nullptr;
+        AdjacencyList* uAdjList = nullptr;
 
         while (not minPQueue.IsEmpty())
         {
-            u = minPQueue.Dequeue();
+            entry = minPQueue.Dequeue();
+            u = entry.second;
+
+            // Outdated entry, the vertex was dequeued before with a smaller cost
+            if (entry.first > cost[u])
+                continue;
 
-            uAdjList = u->GetAdjacencyList();
+            uAdjList = this->m_vertices[u].GetAdjacencyList();
 
             for (std::size_t i = 0; i < uAdjList->Size(); i++)
             {
-                uv = uAdjList->At(i)->GetVertices(); // Edge uv (or vu, is non-directed)
+                if (this->m_prefetchDistance > 0)
+                {
+                    this->PrefetchEdges(uAdjList, i);
+                    this->PrefetchNeighbor(uAdjList, i, cost);
+                }
 
-                // Get the pointer do neighbor vertex, since one end of the edge is vertex u,
-                // and the other end is vertex v
-                uv.first == u->GetID() ? v = &this->m_vertices[uv.second]
-                                       : v = &this->m_vertices[uv.first];
+                // The arc points to the neighbor v and carries the weights of the edge uv
+                v = uAdjList->At(i).GetHead();
 
-                if (this->Relax(u, v, uAdjList->At(i), edgeInfo))
+                if (this->Relax(u, uAdjList->At(i), edgeInfo, workspace))
                 {
                     // If the neighbor's cost is updated, then add again to queue to
                     // update all neighbors with new cost
-                    minPQueue.Enqueue(v);
+                    minPQueue.Enqueue(VertexEntry(cost[v], v));
                 }
             }
         }
+    }
+
+    DenseGraph* Graph::GetDenseGraph()
+    {
+        std::lock_guard<std::mutex> lock(this->m_denseMutex);
+
+        if (this->m_denseGraph == nullptr or this->m_denseOutdated)
+        {
+            this->m_denseGraph = std::make_unique<DenseGraph>(*this);
+            this->m_denseOutdated = false;
+        }
+
+        return this->m_denseGraph.get();
+    }
+
+    void Graph::DenseShortestPaths(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace)
+    {
+        Vector<Defs::EdgeID> &edge2Father = workspace.m_denseEdges;
+
+        this->GetDenseGraph()->Dijkstra(source, edgeInfo, workspace.m_denseKeys, workspace.m_cost, edge2Father);
 
         for (std::size_t i = 0; i < this->m_vertices.Size(); i++)
         {
-            printf("%zu\n", this->m_vertices[i].GetCost());
+            if (edge2Father[i] == DenseGraph::NO_EDGE)
+                workspace.m_edge2Father[i] = nullptr;
+            else
+                workspace.m_edge2Father[i] = this->m_edges[edge2Father[i]];
+        }
+    }
+
+    ShortestPathResult Graph::Dijkstra(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace)
+    {
+        if (this->IsDense())
+            this->DenseShortestPaths(source, edgeInfo, workspace);
+        else if (this->m_dijkstraQueue == DARY_HEAP)
+            this->ShortestPaths(source, edgeInfo, workspace, workspace.m_vertexHeap);
+        else
+            this->ShortestPaths(source, edgeInfo, workspace, workspace.m_binaryHeap);
+
+        workspace.EndQuery();
+
+        std::size_t numVertices = this->m_vertices.Size();
+        ShortestPathResult result;
+
+        result.m_source = source;
+        result.m_maxYear = 0;
+
+        if (numVertices == 0)
+            return result;
+
+        result.m_distances = std::span<const std::size_t>(&workspace.m_cost[0], numVertices);
+        result.m_parentEdges = std::span<Edge* const>(&workspace.m_edge2Father[0], numVertices);
 
+        for (std::size_t i = 0; i < numVertices; i++)
+        {
             // Source has not a edge to father
             // Get the max construction year of the edges that are part of the shortest path
-            if (i != source and this->m_vertices[i].GetEdge2Father()->GetConstructionYear() > maxEdgeConstructionYear)
-                maxEdgeConstructionYear = this->m_vertices[i].GetEdge2Father()->GetConstructionYear();
+            if (i != source and workspace.m_edge2Father[i] != nullptr and
+                workspace.m_edge2Father[i]->GetConstructionYear() > result.m_maxYear)
+                result.m_maxYear = workspace.m_edge2Father[i]->GetConstructionYear();
         }
 
-        printf("%u\n", maxEdgeConstructionYear);
+        return result;
     }
 
-    void Graph::PrimMST(std::size_t source, Defs::EDGE_INFO edgeInfo)
+    ShortestPathResult Graph::Dijkstra(Defs::VertexID source, Defs::EDGE_INFO edgeInfo)
     {
-        heap::PriorityQueue<std::shared_ptr<Edge>, Edge::CompareEdges> minPQueue((Edge::CompareEdges(edgeInfo)));
+        return this->Dijkstra(source, edgeInfo, *this->GetDefaultWorkspace());
+    }
 
+    void Graph::SpanningTree(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace)
+    {
         // Auxiliar variables to make code most legible
-        std::shared_ptr<Edge> u = nullptr;
-        std::shared_ptr<Edge> v = nullptr;
-        std::pair<std::size_t, std::size_t> uv;
-        uint32_t maxEdgeConstructionYear = 0;
+        Edge* u = nullptr;
+        std::pair<Defs::VertexID, Defs::VertexID> uv;
         bool uInMST, vInMST;
-        Vector<std::shared_ptr<Edge>>* uAdjList = nullptr;
+        AdjacencyList* uAdjList = nullptr;
 
-        // Initialize all vertex costs to infinity
-        // Add all vertices to the priority queue
-        for (std::size_t i = 0; i < this->m_vertices.Size(); i++)
-        {
-            this->m_vertices[i].SetVisited(false);
+        Vector<uint8_t> &visited = workspace.m_visited;
+        Vector<uint8_t> &inMST = workspace.m_inMST;
+        std::vector<EdgeEntry> &batch = workspace.m_batch; // Edges of a vertex, added to the queue at once
+        heap::DaryHeap<Defs::EdgeID> &minPQueue = workspace.m_edgeHeap;
 
-            uAdjList = this->m_vertices[i].GetAdjacencyList();
-            for (std::size_t j = 0; j < uAdjList->Size(); j++)
-            {
-                uAdjList->At(j)->SetInMST(false);
-            }
-        }
+        for (std::size_t i = 0; i < this->m_vertices.Size(); i++)
+            visited[i] = false;
 
-        this->m_vertices[source].SetVisited(true);
-        Vector<std::shared_ptr<Edge>> MST;
+        for (std::size_t i = 0; i < this->m_edges.size(); i++)
+            inMST[i] = false;
 
+        visited[source] = true;
+        batch.clear();
 
         uAdjList = this->m_vertices[source].GetAdjacencyList();
-        for (std::size_t i = 0; i < uAdjList->Size(); i++)
-        {
-            minPQueue.Enqueue(uAdjList->At(i));
-        }
+        for (auto &arc : *uAdjList)
+            batch.push_back(EdgeEntry(this->GetWeight(arc, edgeInfo), arc.GetEdgeID()));
+
+        // The queue starts with the edges of the source, built in linear time
+        minPQueue.EnqueueBatch(batch.begin(), batch.end());
 
-        Vector<std::shared_ptr<Edge>> aux;
         while (not minPQueue.IsEmpty())
         {
-            u = minPQueue.Dequeue();
+            u = this->m_edges[minPQueue.Dequeue().second];
             uv = u->GetVertices();
 
-            if (u->IsInMST())
+            if (inMST[u->GetID()])
                 continue;
 
-            uInMST = this->m_vertices[uv.first].WasVisited();
-            vInMST = this->m_vertices[uv.second].WasVisited();
+            uInMST = visited[uv.first];
+            vInMST = visited[uv.second];
 
             if (uInMST != vInMST) // If b not in A
             {
-                this->m_vertices[uv.second].SetVisited(true);
-                this->m_vertices[uv.first].SetVisited(true);
-                MST.PushBack(u);
-                u->SetInMST(true);
+                visited[uv.second] = true;
+                visited[uv.first] = true;
+                workspace.m_MST.push_back(u);
+                inMST[u->GetID()] = true;
+
+                batch.clear();
 
                 uAdjList = this->m_vertices[uv.second].GetAdjacencyList();
                 for (std::size_t i = 0; i < uAdjList->Size(); i++)
                 {
-                    if (not uAdjList->At(i)->IsInMST())
-                        minPQueue.Enqueue(uAdjList->At(i));
+                    if (this->m_prefetchDistance > 0)
+                        this->PrefetchEdges(uAdjList, i);
+
+                    const Arc &arc = uAdjList->At(i);
+
+                    if (not inMST[arc.GetEdgeID()])
+                        batch.push_back(EdgeEntry(this->GetWeight(arc, edgeInfo), arc.GetEdgeID()));
                 }
 
                 uAdjList = this->m_vertices[uv.first].GetAdjacencyList();
                 for (std::size_t i = 0; i < uAdjList->Size(); i++)
                 {
-                    if (not uAdjList->At(i)->IsInMST())
-                        minPQueue.Enqueue(uAdjList->At(i));
+                    if (this->m_prefetchDistance > 0)
+                        this->PrefetchEdges(uAdjList, i);
+
+                    const Arc &arc = uAdjList->At(i);
+
+                    if (not inMST[arc.GetEdgeID()])
+                        batch.push_back(EdgeEntry(this->GetWeight(arc, edgeInfo), arc.GetEdgeID()));
                 }
+
+                // Bottom-up insertion, linear in the degree instead of one sift up per edge
+                minPQueue.EnqueueBatch(batch.begin(), batch.end());
             }
         }
+    }
 
-        if (edgeInfo == Defs::YEAR)
-        {
-            for (auto edge : MST)
-            {
-                if (edge->GetConstructionYear() > maxEdgeConstructionYear)
-                    maxEdgeConstructionYear = edge->GetConstructionYear();
-            }
+    void Graph::DenseSpanningTree(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace)
+    {
+        std::vector<Defs::EdgeID> &edgeIDs = workspace.m_denseTree;
 
-            printf("%u\n", maxEdgeConstructionYear);
-        }
+        edgeIDs.clear();
+        this->GetDenseGraph()->PrimMST(source, edgeInfo, workspace.m_denseKeys, workspace.m_denseEdges, edgeIDs);
+
+        for (auto edgeID : edgeIDs)
+            workspace.m_MST.push_back(this->m_edges[edgeID]);
+    }
+
+    SpanningTreeResult Graph::PrimMST(Defs::VertexID source, Defs::EDGE_INFO edgeInfo, QueryWorkspace &workspace)
+    {
+        workspace.m_MST.clear();
+        workspace.ReserveEdges(this->m_edges.size());
+
+        if (this->IsDense())
+            this->DenseSpanningTree(source, edgeInfo, workspace);
+        else
+            this->SpanningTree(source, edgeInfo, workspace);
+
+        SpanningTreeResult result;
+        std::vector<Defs::EdgeID> &edgeIDs = workspace.m_MSTEdgeIDs;
+
+        result.m_bottleneckYear = 0;
+        result.m_totalCost = 0;
+        edgeIDs.clear();
 
-        if (edgeInfo == Defs::COST)
+        for (auto mstEdge : workspace.m_MST)
         {
-            std::size_t mstCost = 0;
-            for (auto edge : MST)
-            {
-                mstCost += edge->GetBuildCost();
-            }
+            edgeIDs.push_back(mstEdge->GetID());
+            result.m_totalCost += mstEdge->GetBuildCost();
 
-            printf("%zu\n", mstCost);
+            if (mstEdge->GetConstructionYear() > result.m_bottleneckYear)
+                result.m_bottleneckYear = mstEdge->GetConstructionYear();
         }
+
+        result.m_edges = std::span<Edge* const>(workspace.m_MST);
+        result.m_edgeIDs = std::span<const Defs::EdgeID>(edgeIDs);
+
+        workspace.EndQuery();
+
+        return result;
+    }
+
+    SpanningTreeResult Graph::PrimMST(Defs::VertexID source, Defs::EDGE_INFO edgeInfo)
+    {
+        return this->PrimMST(source, edgeInfo, *this->GetDefaultWorkspace());
     }
 }
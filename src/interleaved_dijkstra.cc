@@ -0,0 +1,164 @@
+/*
+* Filename: interleaved_dijkstra.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "interleaved_dijkstra.h"
+
+namespace geom
+{
+    InterleavedDijkstra::InterleavedDijkstra(const StaticGraph &graph, std::size_t numInFlight,
+                                             Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+
+        for (std::size_t i = 0; i < std::max<std::size_t>(1, numInFlight); i++)
+        {
+            std::unique_ptr<Slot> slot = std::make_unique<Slot>();
+            slot->m_dist.Resize(graph.GetNumVertices());
+            slot->m_source = 0;
+            this->m_slots.push_back(std::move(slot));
+        }
+    }
+
+    InterleavedDijkstra::~InterleavedDijkstra() { }
+
+    InterleavedDijkstra::Task InterleavedDijkstra::Search(Slot* slot)
+    {
+        const StaticGraph &graph = *this->m_graph;
+        Vector<std::size_t> &dist = slot->m_dist;
+
+        // A query dropped by a consumer exception may have left entries behind
+        while (not slot->m_queue.IsEmpty())
+            slot->m_queue.Dequeue();
+
+        for (std::size_t i = 0; i < graph.GetNumVertices(); i++)
+            dist[i] = Defs::INFINITY_VALUE;
+
+        dist[slot->m_source] = 0;
+        slot->m_queue.Enqueue(Entry(0, slot->m_source));
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        Defs::EdgeID first, last;
+        Defs::VertexID v;
+        std::size_t vCost;
+
+        while (not slot->m_queue.IsEmpty())
+        {
+            entry = slot->m_queue.Dequeue();
+
+            // Outdated entry, the vertex was settled with a smaller distance
+            if (entry.first > dist[entry.second])
+                continue;
+
+            // Bring the arc range of the vertex, then let another query run
+            graph.PrefetchVertex(entry.second);
+            co_await std::suspend_always();
+
+            first = graph.FirstArc(entry.second);
+            last = graph.FirstArc(entry.second + 1);
+
+            // Bring the adjacency row and its weights, one prefetch per cache line
+            graph.PrefetchArcs(first, last);
+            co_await std::suspend_always();
+
+            // Bring the distances of the neighbors
+            for (Defs::EdgeID arc = first; arc < last; arc++)
+                __builtin_prefetch(&dist[graph.GetHead(arc)], 1);
+            co_await std::suspend_always();
+
+            for (Defs::EdgeID arc = first; arc < last; arc++)
+            {
+                v = graph.GetHead(arc);
+                vCost = entry.first + graph.GetWeight(arc, this->m_edgeInfo);
+
+                if (vCost < dist[v])
+                {
+                    dist[v] = vCost;
+                    slot->m_queue.Enqueue(Entry(vCost, v));
+                }
+            }
+        }
+    }
+
+    void InterleavedDijkstra::Run(const Vector<std::size_t> &sources, const Consumer &consumer)
+    {
+        std::size_t next = 0;
+        std::size_t numRunning = 0;
+
+        // Start the first K queries
+        for (auto &slot : this->m_slots)
+        {
+            if (next == sources.Size())
+                break;
+
+            slot->m_source = sources[next++];
+            slot->m_task = this->Search(slot.get());
+            numRunning++;
+        }
+
+        try
+        {
+            // Round robin over the queries in flight. A finished query hands its distances
+            // to the consumer and its slot takes the next source
+            while (numRunning > 0)
+            {
+                for (auto &slot : this->m_slots)
+                {
+                    if (not slot->m_task.m_handle)
+                        continue;
+
+                    slot->m_task.m_handle.resume();
+
+                    if (not slot->m_task.m_handle.done())
+                        continue;
+
+                    slot->m_task = Task();
+                    consumer(slot->m_source, slot->m_dist);
+
+                    if (next < sources.Size())
+                    {
+                        slot->m_source = sources[next++];
+                        slot->m_task = this->Search(slot.get());
+                    }
+                    else
+                    {
+                        numRunning--;
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            // Drop the other queries in flight, so their coroutines do not outlive the run
+            for (auto &slot : this->m_slots)
+                slot->m_task = Task();
+
+            throw;
+        }
+    }
+
+    InterleavedDijkstra::Throughput InterleavedDijkstra::Benchmark(const Vector<std::size_t> &sources)
+    {
+        Throughput throughput;
+
+        auto start = std::chrono::steady_clock::now();
+        this->Run(sources, [](std::size_t, const Vector<std::size_t> &) { });
+        std::chrono::duration<double> interleaved = std::chrono::steady_clock::now() - start;
+
+        ShortestPathTree tree(*this->m_graph, this->m_edgeInfo);
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < sources.Size(); i++)
+            tree.Run(sources[i]);
+        std::chrono::duration<double> sequential = std::chrono::steady_clock::now() - start;
+
+        throughput.m_interleaved = sources.Size() / interleaved.count();
+        throughput.m_sequential = sources.Size() / sequential.count();
+
+        return throughput;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+* Filename: isochrone.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "isochrone.h"
+
+namespace geom
+{
+    Isochrone::Isochrone(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+
+        // The only O(N) initialization, the queries reset what they touched
+        this->m_dist.Resize(graph.GetNumVertices());
+
+        for (std::size_t i = 0; i < graph.GetNumVertices(); i++)
+            this->m_dist[i] = Defs::INFINITY_VALUE;
+    }
+
+    Isochrone::~Isochrone() { }
+
+    void Isochrone::Reset()
+    {
+        for (auto vertexID : this->m_touched)
+            this->m_dist[vertexID] = Defs::INFINITY_VALUE;
+
+        this->m_touched.clear();
+        this->m_reached.clear();
+    }
+
+    const std::vector<Defs::VertexID> &Isochrone::Query(std::size_t source, std::size_t limit)
+    {
+        this->Reset();
+
+        this->m_dist[source] = 0;
+        this->m_touched.push_back(source);
+        this->m_queue.Enqueue(Entry(0, source));
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        Defs::VertexID v;
+        std::size_t vDist;
+
+        // Only distances within the limit are queued, so the queue empties by itself
+        while (not this->m_queue.IsEmpty())
+        {
+            entry = this->m_queue.Dequeue();
+
+            // Outdated entry, the vertex was settled with a smaller distance
+            if (entry.first > this->m_dist[entry.second])
+                continue;
+
+            this->m_reached.push_back(entry.second);
+
+            for (Defs::EdgeID arc = this->m_graph->FirstArc(entry.second);
+                 arc < this->m_graph->FirstArc(entry.second + 1); arc++)
+            {
+                v = this->m_graph->GetHead(arc);
+                vDist = entry.first + this->m_graph->GetWeight(arc, this->m_edgeInfo);
+
+                if (vDist <= limit and vDist < this->m_dist[v])
+                {
+                    if (this->m_dist[v] == Defs::INFINITY_VALUE)
+                        this->m_touched.push_back(v);
+
+                    this->m_dist[v] = vDist;
+                    this->m_queue.Enqueue(Entry(vDist, v));
+                }
+            }
+        }
+
+        return this->m_reached;
+    }
+
+    std::size_t Isochrone::GetNumTouched() const
+    {
+        return this->m_touched.size();
+    }
+}
@@ -8,11 +8,110 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
+#include <vector>
+
+#include "binary_result.h"
 #include "graph.h"
+#include "output_writer.h"
+
+/**
+ * @brief Print the results: the cost of each vertex, the max construction year on the
+ *        shortest path tree, the max construction year of the MST by year and the build
+ *        cost of the MST by cost, one per line
+ **/
+static void PrintResult(const geom::ShortestPathResult &paths, const geom::SpanningTreeResult &yearTree,
+                        const geom::SpanningTreeResult &costTree)
+{
+    geom::OutputWriter output;
+
+    // The costs are formatted in parallel for large graphs
+    output.WriteLines(paths.m_distances.data(), paths.m_distances.size());
+    output.WriteLine(paths.m_maxYear);
+    output.WriteLine(yearTree.m_bottleneckYear);
+    output.WriteLine(costTree.m_totalCost);
+    output.Flush();
+}
+
+/**
+ * @brief Save the results to a binary file instead of printing them
+ * @param fileName Name of the binary file
+ * @param withEdges Also save the parent edges and the edges of the MST by cost
+ * @return True if the file was written
+ **/
+static bool SaveBinaryResult(const geom::ShortestPathResult &paths, const geom::SpanningTreeResult &yearTree,
+                             const geom::SpanningTreeResult &costTree, const char* fileName, bool withEdges)
+{
+    std::vector<uint64_t> distances(paths.m_distances.begin(), paths.m_distances.end());
+    std::vector<uint64_t> parents, mstEdges;
+
+    if (withEdges)
+    {
+        parents.resize(paths.m_parentEdges.size(), geom::BinaryResult::NO_EDGE);
+
+        for (std::size_t i = 0; i < paths.m_parentEdges.size(); i++)
+        {
+            if (paths.m_parentEdges[i] != nullptr)
+                parents[i] = paths.m_parentEdges[i]->GetID();
+        }
+
+        mstEdges.assign(costTree.m_edgeIDs.begin(), costTree.m_edgeIDs.end());
+    }
+
+    geom::BinaryResult result;
+    uint32_t flags = withEdges ? geom::BinaryResult::FLAG_PARENT_EDGES | geom::BinaryResult::FLAG_MST_EDGES : 0;
+
+    if (not result.Open(fileName, distances.size(), flags, mstEdges.size()))
+        return false;
+
+    result.WriteDistances(distances);
+    result.WriteResults(paths.m_maxYear, yearTree.m_bottleneckYear, costTree.m_totalCost);
+    result.WriteEdges(parents);
+    result.WriteEdges(mstEdges);
+
+    return result.Close();
+}
+
+/**
+ * @brief Print the options of the program to the standard error
+ **/
+static void PrintUsage(const char* programName)
+{
+    fprintf(stderr, "Usage: %s [--binary FILE [--edges]] < INPUT\n", programName);
+}
 
 int main(int argc, char *argv[])
 {
+    // Options: --binary FILE saves the results to FILE instead of printing them, and
+    // --edges also saves the parent edges and the MST edges
+    const char* binaryFileName = nullptr;
+    bool withEdges = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--binary") == 0 and i + 1 < argc)
+        {
+            binaryFileName = argv[++i];
+        }
+        else if (strcmp(argv[i], "--edges") == 0)
+        {
+            withEdges = true;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // The edges only go to the binary file
+    if (withEdges and binaryFileName == nullptr)
+    {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
     std::size_t numVertices, numEdges;
 
     scanf("%zu %zu", &numVertices, &numEdges);
@@ -25,19 +124,53 @@ int main(int argc, char *argv[])
         graph.AddVertex(geom::Vertex(i));
     }
 
-    std::size_t u, v; // Vertices u and v
-    uint32_t constructionYear, crossingTime, buildCost;
+    // The edges are read first, so that each adjacency list is reserved for its degree
+    struct InputEdge
+    {
+        std::size_t m_u, m_v; // Vertices u and v
+        uint32_t m_constructionYear, m_crossingTime, m_buildCost;
+    };
+
+    std::vector<InputEdge> edges(numEdges);
+    std::vector<std::size_t> degrees(numVertices, 0);
 
-    for (std::size_t i = 0; i < numEdges; i++)
+    for (auto &edge : edges)
     {
-        scanf("%zu %zu %u %u %u", &u, &v, &constructionYear, &crossingTime, &buildCost);
-        graph.AddEdge(u - 1, v - 1, constructionYear, crossingTime, buildCost);
+        scanf("%zu %zu %u %u %u", &edge.m_u, &edge.m_v, &edge.m_constructionYear, &edge.m_crossingTime,
+              &edge.m_buildCost);
+
+        degrees[edge.m_u - 1]++;
+        degrees[edge.m_v - 1]++;
     }
 
+    for (std::size_t i = 0; i < numVertices; i++)
+        graph.ReserveDegree(i, degrees[i]);
+
+    for (auto &edge : edges)
+        graph.AddEdge(edge.m_u - 1, edge.m_v - 1, edge.m_constructionYear, edge.m_crossingTime, edge.m_buildCost);
+
     std::size_t palaceIndex = 0;
-    graph.Dijkstra(palaceIndex, Defs::EDGE_INFO::TIME);
-    graph.PrimMST(palaceIndex, Defs::EDGE_INFO::YEAR);
-    graph.PrimMST(palaceIndex, Defs::EDGE_INFO::COST);
 
-    return EXIT_SUCCESS;
+    // Each query runs on its own workspace, so the three results stay valid together
+    geom::WorkspacePool* pool = graph.GetWorkspacePool();
+    geom::QueryWorkspace* pathWorkspace = pool->Acquire();
+    geom::QueryWorkspace* yearWorkspace = pool->Acquire();
+    geom::QueryWorkspace* costWorkspace = pool->Acquire();
+
+    geom::ShortestPathResult paths = graph.Dijkstra(palaceIndex, Defs::EDGE_INFO::TIME, *pathWorkspace);
+    geom::SpanningTreeResult yearTree = graph.PrimMST(palaceIndex, Defs::EDGE_INFO::YEAR, *yearWorkspace);
+    geom::SpanningTreeResult costTree = graph.PrimMST(palaceIndex, Defs::EDGE_INFO::COST, *costWorkspace);
+
+    bool ok = true;
+
+    if (binaryFileName != nullptr)
+        ok = SaveBinaryResult(paths, yearTree, costTree, binaryFileName, withEdges);
+    else
+        PrintResult(paths, yearTree, costTree);
+
+    pool->Release(costWorkspace);
+    pool->Release(yearWorkspace);
+    pool->Release(pathWorkspace);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,215 @@
+/*
+* Filename: multi_source_simd.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "multi_source_simd.h"
+
+namespace geom
+{
+    MultiSourceSIMD::MultiSourceSIMD(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo, KERNEL maxKernel)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+        this->m_saturated = false;
+        this->m_frontierSize[0] = this->m_frontierSize[1] = 0;
+        this->m_next = 0;
+
+        if (maxKernel >= AVX512 and __builtin_cpu_supports("avx512f"))
+        {
+            this->m_kernel = AVX512;
+            this->m_numLanes = 16;
+        }
+        else if (maxKernel >= AVX2 and __builtin_cpu_supports("avx2"))
+        {
+            this->m_kernel = AVX2;
+            this->m_numLanes = 8;
+        }
+        else
+        {
+            this->m_kernel = SCALAR;
+            this->m_numLanes = 8;
+        }
+
+        this->m_dist.Resize(graph.GetNumVertices() * this->m_numLanes);
+        this->m_frontier[0].Resize(graph.GetNumVertices());
+        this->m_frontier[1].Resize(graph.GetNumVertices());
+        this->m_inNextFrontier.Resize(graph.GetNumVertices());
+
+        for (std::size_t i = 0; i < graph.GetNumVertices(); i++)
+            this->m_inNextFrontier[i] = false;
+    }
+
+    MultiSourceSIMD::~MultiSourceSIMD() { }
+
+    std::size_t MultiSourceSIMD::GetNumLanes() const
+    {
+        return this->m_numLanes;
+    }
+
+    MultiSourceSIMD::KERNEL MultiSourceSIMD::GetKernel() const
+    {
+        return this->m_kernel;
+    }
+
+    void MultiSourceSIMD::RelaxScalar(Defs::VertexID vertexID)
+    {
+        const uint32_t* uDist = &this->m_dist[vertexID * this->m_numLanes];
+        uint32_t* vDist;
+        uint32_t weight;
+        bool changed;
+
+        for (Defs::EdgeID arc = this->m_graph->FirstArc(vertexID); arc < this->m_graph->FirstArc(vertexID + 1); arc++)
+        {
+            vDist = &this->m_dist[this->m_graph->GetHead(arc) * this->m_numLanes];
+            weight = this->m_graph->GetWeight(arc, this->m_edgeInfo);
+            changed = false;
+
+            for (std::size_t lane = 0; lane < this->m_numLanes; lane++)
+            {
+                if (uDist[lane] == UNREACHABLE)
+                    continue;
+
+                uint64_t sum = uint64_t(uDist[lane]) + weight;
+
+                if (sum >= UNREACHABLE)
+                {
+                    this->m_saturated = true;
+                    continue;
+                }
+
+                if (sum < vDist[lane])
+                {
+                    vDist[lane] = sum;
+                    changed = true;
+                }
+            }
+
+            if (changed)
+                this->Activate(this->m_graph->GetHead(arc));
+        }
+    }
+
+    __attribute__((target("avx2")))
+    void MultiSourceSIMD::RelaxAVX2(Defs::VertexID vertexID)
+    {
+        const __m256i unreachable = _mm256_set1_epi32(-1);
+        const __m256i uDist = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&this->m_dist[vertexID * 8]));
+        const __m256i uUnreachable = _mm256_cmpeq_epi32(uDist, unreachable);
+
+        __m256i* vAddr;
+        __m256i vDist, sum, overflow, newDist;
+
+        for (Defs::EdgeID arc = this->m_graph->FirstArc(vertexID); arc < this->m_graph->FirstArc(vertexID + 1); arc++)
+        {
+            vAddr = reinterpret_cast<__m256i*>(&this->m_dist[this->m_graph->GetHead(arc) * 8]);
+            vDist = _mm256_loadu_si256(vAddr);
+
+            // Same rule as the scalar kernel: a sum of at least UNREACHABLE does not fit. There
+            // is no unsigned saturating 32-bit add, so the sum wrapped iff it is below uDist
+            sum = _mm256_add_epi32(uDist, _mm256_set1_epi32(this->m_graph->GetWeight(arc, this->m_edgeInfo)));
+            overflow = _mm256_andnot_si256(_mm256_cmpeq_epi32(sum, uDist),
+                                           _mm256_cmpeq_epi32(_mm256_min_epu32(sum, uDist), sum));
+            overflow = _mm256_or_si256(overflow, _mm256_cmpeq_epi32(sum, unreachable));
+
+            if (_mm256_movemask_epi8(_mm256_andnot_si256(uUnreachable, overflow)))
+                this->m_saturated = true;
+
+            sum = _mm256_or_si256(sum, overflow);
+            newDist = _mm256_min_epu32(vDist, sum);
+
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(newDist, vDist)) != -1)
+            {
+                _mm256_storeu_si256(vAddr, newDist);
+                this->Activate(this->m_graph->GetHead(arc));
+            }
+        }
+    }
+
+    __attribute__((target("avx512f")))
+    void MultiSourceSIMD::RelaxAVX512(Defs::VertexID vertexID)
+    {
+        const __m512i unreachable = _mm512_set1_epi32(-1);
+        const __m512i uDist = _mm512_loadu_si512(&this->m_dist[vertexID * 16]);
+        const __mmask16 uUnreachable = _mm512_cmpeq_epi32_mask(uDist, unreachable);
+
+        uint32_t* vAddr;
+        __m512i vDist, sum, newDist;
+        __mmask16 overflow;
+
+        for (Defs::EdgeID arc = this->m_graph->FirstArc(vertexID); arc < this->m_graph->FirstArc(vertexID + 1); arc++)
+        {
+            vAddr = &this->m_dist[this->m_graph->GetHead(arc) * 16];
+            vDist = _mm512_loadu_si512(vAddr);
+
+            sum = _mm512_add_epi32(uDist, _mm512_set1_epi32(this->m_graph->GetWeight(arc, this->m_edgeInfo)));
+            // Same rule as the scalar kernel: the sum wrapped or is exactly UNREACHABLE
+            overflow = _mm512_cmplt_epu32_mask(sum, uDist) | _mm512_cmpeq_epi32_mask(sum, unreachable);
+
+            if (overflow & ~uUnreachable)
+                this->m_saturated = true;
+
+            sum = _mm512_mask_mov_epi32(sum, overflow, unreachable);
+            newDist = _mm512_min_epu32(vDist, sum);
+
+            if (_mm512_cmpneq_epi32_mask(newDist, vDist))
+            {
+                _mm512_storeu_si512(vAddr, newDist);
+                this->Activate(this->m_graph->GetHead(arc));
+            }
+        }
+    }
+
+    bool MultiSourceSIMD::Run(const std::size_t* sources, std::size_t numSources)
+    {
+        if (numSources > this->m_numLanes)
+            numSources = this->m_numLanes;
+
+        for (std::size_t i = 0; i < this->m_dist.Size(); i++)
+            this->m_dist[i] = UNREACHABLE;
+
+        this->m_saturated = false;
+        this->m_frontierSize[this->m_next] = 0;
+
+        for (std::size_t lane = 0; lane < numSources; lane++)
+        {
+            this->m_dist[sources[lane] * this->m_numLanes + lane] = 0;
+            this->Activate(sources[lane]);
+        }
+
+        std::size_t current;
+
+        while (this->m_frontierSize[this->m_next] > 0)
+        {
+            // The next frontier becomes the current one
+            current = this->m_next;
+            this->m_next = 1 - current;
+            this->m_frontierSize[this->m_next] = 0;
+
+            const Vector<Defs::VertexID> &frontier = this->m_frontier[current];
+
+            for (std::size_t i = 0; i < this->m_frontierSize[current]; i++)
+                this->m_inNextFrontier[frontier[i]] = false;
+
+            for (std::size_t i = 0; i < this->m_frontierSize[current]; i++)
+            {
+                switch (this->m_kernel)
+                {
+                    case AVX512:
+                        this->RelaxAVX512(frontier[i]);
+                        break;
+
+                    case AVX2:
+                        this->RelaxAVX2(frontier[i]);
+                        break;
+
+                    default:
+                        this->RelaxScalar(frontier[i]);
+                }
+            }
+        }
+
+        return not this->m_saturated;
+    }
+}
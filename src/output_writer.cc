@@ -0,0 +1,173 @@
+/*
+* Filename: output_writer.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "output_writer.h"
+
+namespace geom
+{
+    const char OutputWriter::DIGIT_PAIRS[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    OutputWriter::OutputWriter(int fd, std::size_t bufferSize)
+    {
+        this->m_fd = fd;
+        this->m_buffer.resize(bufferSize < MAX_DIGITS ? MAX_DIGITS : bufferSize);
+        this->m_size = 0;
+        this->SetNumThreads(0);
+    }
+
+    OutputWriter::~OutputWriter()
+    {
+        this->Flush();
+    }
+
+    bool OutputWriter::Flush()
+    {
+        std::size_t written = 0;
+        ssize_t result;
+
+        // write may take only part of the buffer, or be interrupted by a signal
+        while (written < this->m_size)
+        {
+            result = write(this->m_fd, &this->m_buffer[written], this->m_size - written);
+
+            if (result < 0 and errno == EINTR)
+                continue;
+
+            if (result <= 0)
+            {
+                std::cerr << "Could not write the output: " << strerror(errno) << std::endl;
+                this->m_size = 0;
+                return false;
+            }
+
+            written += result;
+        }
+
+        this->m_size = 0;
+
+        return true;
+    }
+
+    void OutputWriter::SetNumThreads(std::size_t numThreads)
+    {
+        if (numThreads == 0)
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        this->m_numThreads = numThreads;
+    }
+
+    bool OutputWriter::WriteBuffers(std::vector<struct iovec> &buffers)
+    {
+        std::size_t first = 0;
+        ssize_t result;
+
+        while (first < buffers.size())
+        {
+            result = writev(this->m_fd, &buffers[first], std::min<std::size_t>(buffers.size() - first, IOV_MAX));
+
+            if (result < 0 and errno == EINTR)
+                continue;
+
+            if (result <= 0)
+            {
+                std::cerr << "Could not write the output: " << strerror(errno) << std::endl;
+                return false;
+            }
+
+            // Skip the buffers written whole, and the written part of the next one
+            std::size_t written = result;
+
+            while (first < buffers.size() and written >= buffers[first].iov_len)
+                written -= buffers[first++].iov_len;
+
+            if (first < buffers.size())
+            {
+                buffers[first].iov_base = static_cast<char*>(buffers[first].iov_base) + written;
+                buffers[first].iov_len -= written;
+            }
+        }
+
+        return true;
+    }
+
+    bool OutputWriter::WriteLines(const std::size_t* values, std::size_t count)
+    {
+        if (count < 2 * MIN_RANGE_SIZE or this->m_numThreads == 1)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                this->WriteLine(values[i]);
+
+            return this->Flush();
+        }
+
+        if (not this->Flush())
+            return false;
+
+        // One range per thread, unless the ranges would be too short
+        std::size_t numRanges = std::min(this->m_numThreads, count / MIN_RANGE_SIZE);
+        std::size_t rangeSize = (count + numRanges - 1) / numRanges;
+
+        if (this->m_rangeBuffers.size() < numRanges)
+        {
+            this->m_rangeBuffers.resize(numRanges);
+            this->m_rangeSizes.resize(numRanges);
+        }
+
+        std::atomic<std::size_t> next(0);
+
+        auto worker = [this, values, count, numRanges, rangeSize, &next]() {
+            for (std::size_t r = next++; r < numRanges; r = next++)
+            {
+                std::size_t first = r * rangeSize;
+                std::size_t last = std::min(count, first + rangeSize);
+                std::vector<char> &buffer = this->m_rangeBuffers[r];
+                std::size_t size = 0;
+
+                // Room for the longest lines, so the loop never checks it
+                if (buffer.size() < (last - first) * (MAX_DIGITS + 1))
+                    buffer.resize((last - first) * (MAX_DIGITS + 1));
+
+                for (std::size_t i = first; i < last; i++)
+                {
+                    size += FormatUInt(values[i], &buffer[size]);
+                    buffer[size++] = '\n';
+                }
+
+                this->m_rangeSizes[r] = size;
+            }
+        };
+
+        // The calling thread is also a worker
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < numRanges; i++)
+            workers.emplace_back(worker);
+
+        worker();
+
+        for (auto &thread : workers)
+            thread.join();
+
+        std::vector<struct iovec> buffers(numRanges);
+
+        for (std::size_t r = 0; r < numRanges; r++)
+        {
+            buffers[r].iov_base = this->m_rangeBuffers[r].data();
+            buffers[r].iov_len = this->m_rangeSizes[r];
+        }
+
+        return this->WriteBuffers(buffers);
+    }
+}
@@ -0,0 +1,152 @@
+/*
+* Filename: query_workspace.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "query_workspace.h"
+
+namespace geom
+{
+    QueryWorkspace::QueryWorkspace(std::size_t numVertices)
+    {
+        this->m_cost.Resize(numVertices);
+        this->m_edge2Father.Resize(numVertices);
+        this->m_visited.Resize(numVertices);
+        this->m_numEdges = 0;
+
+        this->m_numAllocations = 0;
+
+        // Each array indexed by the vertex ID, and each growing buffer that starts with room
+        // (the first arrays of the heaps), allocated once here
+        for (std::size_t size : { this->m_cost.Size(), this->m_edge2Father.Size(), this->m_visited.Size() })
+        {
+            if (size > 0)
+                this->m_numAllocations++;
+        }
+
+        this->GetCapacities(this->m_capacities);
+
+        for (std::size_t i = 0; i < NUM_BUFFERS; i++)
+        {
+            if (this->m_capacities[i] > 0)
+                this->m_numAllocations++;
+        }
+    }
+
+    QueryWorkspace::~QueryWorkspace() { }
+
+    void QueryWorkspace::GetCapacities(std::size_t* capacities) const
+    {
+        // The keys and the values of a DaryHeap grow together, so each heap is two buffers
+        capacities[0] = this->m_vertexHeap.GetCapacity();
+        capacities[1] = this->m_vertexHeap.GetCapacity();
+        capacities[2] = this->m_edgeHeap.GetCapacity();
+        capacities[3] = this->m_edgeHeap.GetCapacity();
+        capacities[4] = this->m_batch.capacity();
+        capacities[5] = this->m_MST.capacity();
+        capacities[6] = this->m_MSTEdgeIDs.capacity();
+        capacities[7] = this->m_denseKeys.Size();
+        capacities[8] = this->m_denseEdges.Size();
+        capacities[9] = this->m_denseTree.capacity();
+        capacities[10] = this->m_inMST.Size();
+    }
+
+    void QueryWorkspace::ReserveEdges(std::size_t numEdges)
+    {
+        if (this->m_numEdges != numEdges)
+        {
+            this->m_inMST.Resize(numEdges);
+            this->m_numEdges = numEdges;
+        }
+    }
+
+    void QueryWorkspace::EndQuery()
+    {
+        std::size_t capacities[NUM_BUFFERS];
+
+        this->GetCapacities(capacities);
+
+        // Each buffer that grew allocated, whatever the other buffers did
+        for (std::size_t i = 0; i < NUM_BUFFERS; i++)
+        {
+            if (capacities[i] > this->m_capacities[i])
+                this->m_numAllocations++;
+
+            this->m_capacities[i] = capacities[i];
+        }
+    }
+
+    std::size_t QueryWorkspace::GetCost(Defs::VertexID vertexID) const
+    {
+        return this->m_cost[vertexID];
+    }
+
+    Edge* QueryWorkspace::GetEdgeToFather(Defs::VertexID vertexID) const
+    {
+        return this->m_edge2Father[vertexID];
+    }
+
+    const std::vector<Edge*> &QueryWorkspace::GetMST() const
+    {
+        return this->m_MST;
+    }
+
+    std::size_t QueryWorkspace::GetNumAllocations() const
+    {
+        return this->m_numAllocations;
+    }
+
+    WorkspacePool::WorkspacePool(std::size_t numVertices)
+    {
+        this->m_numVertices = numVertices;
+    }
+
+    WorkspacePool::~WorkspacePool() { }
+
+    QueryWorkspace* WorkspacePool::Acquire()
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        if (this->m_free.empty())
+        {
+            this->m_workspaces.push_back(std::make_unique<QueryWorkspace>(this->m_numVertices));
+
+            // Room for every workspace, so that Release never allocates
+            this->m_free.reserve(this->m_workspaces.size());
+
+            return this->m_workspaces.back().get();
+        }
+
+        QueryWorkspace* workspace = this->m_free.back();
+        this->m_free.pop_back();
+
+        return workspace;
+    }
+
+    void WorkspacePool::Release(QueryWorkspace* workspace)
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        this->m_free.push_back(workspace);
+    }
+
+    std::size_t WorkspacePool::GetNumWorkspaces() const
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        return this->m_workspaces.size();
+    }
+
+    std::size_t WorkspacePool::GetNumAllocations() const
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        std::size_t numAllocations = 0;
+
+        for (auto &workspace : this->m_workspaces)
+            numAllocations += workspace->GetNumAllocations();
+
+        return numAllocations;
+    }
+}
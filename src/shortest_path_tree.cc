@@ -0,0 +1,61 @@
+/*
+* Filename: shortest_path_tree.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "shortest_path_tree.h"
+
+namespace geom
+{
+    ShortestPathTree::ShortestPathTree(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+
+        this->m_dist.Resize(graph.GetNumVertices());
+        this->m_parentArc.Resize(graph.GetNumVertices());
+    }
+
+    ShortestPathTree::~ShortestPathTree() { }
+
+    void ShortestPathTree::Run(std::size_t source)
+    {
+        for (std::size_t i = 0; i < this->m_graph->GetNumVertices(); i++)
+        {
+            this->m_dist[i] = Defs::INFINITY_VALUE;
+            this->m_parentArc[i] = NO_ARC;
+        }
+
+        this->m_dist[source] = 0;
+        this->m_queue.Enqueue(Entry(0, source));
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        Defs::VertexID v;
+        std::size_t vCost;
+
+        while (not this->m_queue.IsEmpty())
+        {
+            entry = this->m_queue.Dequeue();
+
+            // Outdated entry, the vertex was settled with a smaller distance
+            if (entry.first > this->m_dist[entry.second])
+                continue;
+
+            for (Defs::EdgeID arc = this->m_graph->FirstArc(entry.second);
+                 arc < this->m_graph->FirstArc(entry.second + 1); arc++)
+            {
+                v = this->m_graph->GetHead(arc);
+                vCost = entry.first + this->m_graph->GetWeight(arc, this->m_edgeInfo);
+
+                if (vCost < this->m_dist[v])
+                {
+                    this->m_dist[v] = vCost;
+                    this->m_parentArc[v] = arc;
+                    this->m_queue.Enqueue(Entry(vCost, v));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,308 @@
+/*
+* Filename: static_graph.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "static_graph.h"
+
+namespace geom
+{
+    StaticGraph::StaticGraph()
+    {
+        this->m_numVertices = 0;
+        this->m_numEdges = 0;
+        this->m_numRegions = 0;
+        this->m_flagWords = 0;
+        this->m_flagsEdgeInfo = Defs::EDGE_INFO::TIME;
+        this->m_wideWeights = false;
+        this->m_firstArc.Resize(1);
+        this->m_firstArc[0] = 0;
+    }
+
+    StaticGraph::StaticGraph(Graph &graph)
+    {
+        this->m_numVertices = graph.GetNumVertices();
+        this->m_numEdges = graph.GetNumEdges();
+        this->m_numRegions = 0;
+        this->m_flagWords = 0;
+        this->m_flagsEdgeInfo = Defs::EDGE_INFO::TIME;
+
+        this->m_firstArc.Resize(this->m_numVertices + 1);
+
+        // The arcs of each vertex are its adjacency list, so the first arc of each vertex
+        // is the prefix sum of the degrees
+        std::size_t numArcs = 0;
+        for (std::size_t i = 0; i < this->m_numVertices; i++)
+        {
+            this->m_firstArc[i] = numArcs;
+            numArcs += graph.GetVertex(i)->GetDegree();
+        }
+        this->m_firstArc[this->m_numVertices] = numArcs;
+
+        this->m_arcs.Resize(numArcs);
+
+        // The adjacency lists already hold the arcs, in the same layout
+        std::size_t arc = 0;
+        for (std::size_t u = 0; u < this->m_numVertices; u++)
+        {
+            for (auto &uArc : *graph.GetVertex(u)->GetAdjacencyList())
+                this->m_arcs[arc++] = uArc;
+        }
+
+        // Weights that do not fit the arcs are copied from the edges of the graph
+        this->m_wideWeights = graph.HasWideWeights();
+
+        if (this->m_wideWeights)
+        {
+            this->m_weights.Resize(3 * numArcs);
+
+            arc = 0;
+            for (std::size_t u = 0; u < this->m_numVertices; u++)
+            {
+                for (auto &uArc : *graph.GetVertex(u)->GetAdjacencyList())
+                {
+                    for (auto edgeInfo : { Defs::YEAR, Defs::TIME, Defs::COST })
+                        this->m_weights[3 * arc + edgeInfo] = graph.GetWeight(uArc, edgeInfo);
+                    arc++;
+                }
+            }
+        }
+    }
+
+    StaticGraph::~StaticGraph() { }
+
+    std::size_t StaticGraph::GetNumVertices() const
+    {
+        return this->m_numVertices;
+    }
+
+    std::size_t StaticGraph::GetNumEdges() const
+    {
+        return this->m_numEdges;
+    }
+
+    std::size_t StaticGraph::GetNumArcs() const
+    {
+        return this->m_arcs.Size();
+    }
+
+    bool StaticGraph::IsPacked() const
+    {
+        return Arc::PACKED and not this->m_wideWeights;
+    }
+
+    void StaticGraph::ResetArcFlags(std::size_t numRegions, Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_numRegions = numRegions;
+        this->m_flagWords = (numRegions + 63) / 64;
+        this->m_flagsEdgeInfo = edgeInfo;
+
+        this->m_regions = Vector<uint32_t>();
+        this->m_regions.Resize(this->m_numVertices);
+        for (std::size_t i = 0; i < this->m_numVertices; i++)
+            this->m_regions[i] = 0;
+
+        this->m_arcFlags = Vector<uint64_t>();
+        this->m_arcFlags.Resize(this->GetNumArcs() * this->m_flagWords);
+        for (std::size_t i = 0; i < this->m_arcFlags.Size(); i++)
+            this->m_arcFlags[i] = 0;
+    }
+
+    void StaticGraph::SetRegion(std::size_t vertexID, uint32_t region)
+    {
+        this->m_regions[vertexID] = region;
+    }
+
+    std::size_t StaticGraph::GetNumRegions() const
+    {
+        return this->m_numRegions;
+    }
+
+    Defs::EDGE_INFO StaticGraph::GetArcFlagsEdgeInfo() const
+    {
+        return this->m_flagsEdgeInfo;
+    }
+
+    bool StaticGraph::Save(const char* fileName) const
+    {
+        FILE* file = fopen(fileName, "wb");
+
+        if (file == nullptr)
+        {
+            std::cerr << "Could not open " << fileName << " to save the graph" << std::endl;
+            return false;
+        }
+
+        // The last word of the header holds the arc layout and whether the wide weights follow the arcs
+        uint32_t header[4] = { FILE_MAGIC, FILE_VERSION, static_cast<uint32_t>(this->m_flagsEdgeInfo),
+                               sizeof(Arc) << 2 | uint32_t(this->m_wideWeights) << 1 | Arc::PACKED };
+        uint64_t sizes[4] = { this->m_numVertices, this->m_numEdges, this->GetNumArcs(), this->m_numRegions };
+        std::size_t numArcs = sizes[2];
+        bool ok = true;
+
+        ok = ok and fwrite(header, sizeof(uint32_t), 4, file) == 4;
+        ok = ok and fwrite(sizes, sizeof(uint64_t), 4, file) == 4;
+        ok = ok and fwrite(&this->m_firstArc[0], sizeof(Defs::EdgeID), sizes[0] + 1, file) == sizes[0] + 1;
+
+        if (numArcs > 0)
+            ok = ok and fwrite(&this->m_arcs[0], sizeof(Arc), numArcs, file) == numArcs;
+
+        if (this->m_wideWeights and numArcs > 0)
+            ok = ok and fwrite(&this->m_weights[0], sizeof(uint32_t), 3 * numArcs, file) == 3 * numArcs;
+
+        // Arc flags section
+        if (this->m_numRegions > 0 and sizes[0] > 0)
+        {
+            ok = ok and fwrite(&this->m_regions[0], sizeof(uint32_t), sizes[0], file) == sizes[0];
+
+            if (numArcs > 0)
+            {
+                ok = ok and fwrite(&this->m_arcFlags[0], sizeof(uint64_t), this->m_arcFlags.Size(), file) ==
+                                this->m_arcFlags.Size();
+            }
+        }
+
+        ok = fclose(file) == 0 and ok;
+
+        if (not ok)
+            std::cerr << "Could not write the graph to " << fileName << std::endl;
+
+        return ok;
+    }
+
+    bool StaticGraph::Load(const char* fileName)
+    {
+        FILE* file = fopen(fileName, "rb");
+
+        if (file == nullptr)
+        {
+            std::cerr << "Could not open " << fileName << " to load the graph" << std::endl;
+            return false;
+        }
+
+        uint32_t header[4];
+        uint64_t sizes[4];
+
+        if (fread(header, sizeof(uint32_t), 4, file) != 4 or fread(sizes, sizeof(uint64_t), 4, file) != 4 or
+            header[0] != FILE_MAGIC or header[1] != FILE_VERSION)
+        {
+            std::cerr << fileName << " is not a graph file" << std::endl;
+            fclose(file);
+            return false;
+        }
+
+        // The arcs are read as they were written, so the file must have the same arc layout
+        if ((header[3] >> 2) != sizeof(Arc) or (header[3] & 1) != Arc::PACKED)
+        {
+            std::cerr << fileName << " was saved by a build with another arc layout (" << (header[3] & 1 ? "packed" : "wide")
+                      << " weights, " << (header[3] >> 2) << "-byte arcs)" << std::endl;
+            fclose(file);
+            return false;
+        }
+
+        // The sizes are checked against the length of the file before anything is allocated.
+        // Each of them is below the length, so the products below do not overflow
+        long headerEnd = ftell(file);
+        fseek(file, 0, SEEK_END);
+        uint64_t length = ftell(file) - headerEnd;
+        bool ok = header[2] <= Defs::EDGE_INFO::COST and sizes[0] < length and sizes[1] <= length and
+                  sizes[2] <= length and sizes[3] <= length and
+                  sizes[0] < std::numeric_limits<Defs::VertexID>::max() and
+                  sizes[2] <= std::numeric_limits<Defs::EdgeID>::max();
+
+        const std::size_t numVertices = sizes[0];
+        const std::size_t numArcs = sizes[2];
+        const std::size_t numRegions = sizes[3];
+        const std::size_t flagWords = (numRegions + 63) / 64;
+        const bool hasFlags = numRegions > 0 and numVertices > 0;
+        const bool wideWeights = (header[3] >> 1) & 1;
+
+        if (ok)
+        {
+            uint64_t expected = (numVertices + 1) * sizeof(Defs::EdgeID) + numArcs * sizeof(Arc) +
+                                (wideWeights ? 3 * numArcs * sizeof(uint32_t) : 0) +
+                                (hasFlags ? numVertices * sizeof(uint32_t) + numArcs * flagWords * sizeof(uint64_t) : 0);
+            ok = length == expected;
+        }
+
+        if (not ok)
+        {
+            std::cerr << fileName << " is truncated or has a wrong size" << std::endl;
+            fclose(file);
+            return false;
+        }
+
+        fseek(file, headerEnd, SEEK_SET);
+
+        // Read into temporaries, so a bad file leaves the current graph untouched
+        Vector<Defs::EdgeID> firstArc;
+        Vector<Arc> arcs;
+        Vector<uint32_t> weights;
+        Vector<uint32_t> regions;
+        Vector<uint64_t> arcFlags;
+
+        firstArc.Resize(numVertices + 1);
+        arcs.Resize(numArcs);
+        weights.Resize(wideWeights ? 3 * numArcs : 0);
+        regions.Resize(hasFlags ? numVertices : 0);
+        arcFlags.Resize(hasFlags ? numArcs * flagWords : 0);
+
+        ok = fread(&firstArc[0], sizeof(Defs::EdgeID), numVertices + 1, file) == numVertices + 1;
+
+        if (numArcs > 0)
+            ok = ok and fread(&arcs[0], sizeof(Arc), numArcs, file) == numArcs;
+
+        if (wideWeights and numArcs > 0)
+            ok = ok and fread(&weights[0], sizeof(uint32_t), 3 * numArcs, file) == 3 * numArcs;
+
+        if (hasFlags)
+        {
+            ok = ok and fread(&regions[0], sizeof(uint32_t), numVertices, file) == numVertices;
+
+            if (numArcs > 0)
+                ok = ok and fread(&arcFlags[0], sizeof(uint64_t), arcFlags.Size(), file) == arcFlags.Size();
+        }
+
+        fclose(file);
+
+        if (not ok)
+        {
+            std::cerr << fileName << " is truncated" << std::endl;
+            return false;
+        }
+
+        // The arc ranges must cover the arcs in order, every arc must point to a vertex and an
+        // edge of the graph, and every vertex must be in a region
+        ok = firstArc[0] == 0 and firstArc[numVertices] == numArcs;
+
+        for (std::size_t u = 0; ok and u < numVertices; u++)
+            ok = firstArc[u] <= firstArc[u + 1];
+
+        for (std::size_t arc = 0; ok and arc < numArcs; arc++)
+            ok = arcs[arc].GetHead() < numVertices and arcs[arc].GetEdgeID() < sizes[1];
+
+        for (std::size_t u = 0; ok and u < regions.Size(); u++)
+            ok = regions[u] < numRegions;
+
+        if (not ok)
+        {
+            std::cerr << fileName << " is corrupted" << std::endl;
+            return false;
+        }
+
+        this->m_numVertices = numVertices;
+        this->m_numEdges = sizes[1];
+        this->m_firstArc = firstArc;
+        this->m_arcs = arcs;
+        this->m_wideWeights = wideWeights;
+        this->m_weights = weights;
+        this->m_numRegions = numRegions;
+        this->m_flagWords = flagWords;
+        this->m_flagsEdgeInfo = static_cast<Defs::EDGE_INFO>(header[2]);
+        this->m_regions = regions;
+        this->m_arcFlags = arcFlags;
+
+        return true;
+    }
+}
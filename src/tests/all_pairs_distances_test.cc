@@ -0,0 +1,60 @@
+/*
+* Filename: all_pairs_distances_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "all_pairs_distances.h"
+
+using namespace geom;
+
+TEST_CASE("AllPairsDistances matches Graph::Dijkstra")
+{
+    std::vector<test::GraphCase> cases = test::GraphCases();
+
+    // Several tiles per side, the last one partial, and vertices 150-159 isolated
+    cases.push_back(test::GraphCase { "several tiles", 160, test::RandomEdges(150, 600, 0, 20, 6) });
+
+    for (auto &graphCase : cases)
+    {
+        for (std::size_t numThreads : { 1, 3 })
+        {
+            std::string name = graphCase.m_name + ", " + std::to_string(numThreads) + " threads";
+
+            SUBCASE(name.c_str())
+            {
+                auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+                StaticGraph staticGraph(*graph);
+
+                for (auto edgeInfo : { Defs::TIME, Defs::COST })
+                {
+                    AllPairsDistances distances(staticGraph, numThreads, edgeInfo);
+
+                    distances.Run();
+                    REQUIRE(distances.GetNumVertices() == graphCase.m_numVertices);
+
+                    for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+                    {
+                        std::vector<std::size_t> reference = test::ReferenceDistances(*graph, s, edgeInfo);
+
+                        for (std::size_t t = 0; t < graphCase.m_numVertices; t++)
+                            REQUIRE(distances.GetDistance(s, t) == reference[t]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("AllPairsDistances on an empty graph")
+{
+    auto graph = test::MakeGraph(0, {});
+    StaticGraph staticGraph(*graph);
+    AllPairsDistances distances(staticGraph, 2);
+
+    distances.Run();
+
+    CHECK(distances.GetNumVertices() == 0);
+}
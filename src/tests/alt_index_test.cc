@@ -0,0 +1,58 @@
+/*
+* Filename: alt_index_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "alt_index.h"
+
+using namespace geom;
+
+TEST_CASE("ALTIndex matches Graph::Dijkstra")
+{
+    for (auto selection : { ALTIndex::FARTHEST, ALTIndex::DEGREE })
+    {
+        for (auto &graphCase : test::GraphCases())
+        {
+            std::string name = graphCase.m_name + (selection == ALTIndex::FARTHEST ? ", farthest" : ", degree");
+
+            SUBCASE(name.c_str())
+            {
+                auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+                StaticGraph staticGraph(*graph);
+                ALTIndex index(staticGraph, 4, selection, 2);
+
+                for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+                {
+                    std::vector<std::size_t> reference = test::ReferenceDistances(*graph, s);
+
+                    for (std::size_t t = 0; t < graphCase.m_numVertices; t++)
+                    {
+                        Path path = index.Query(s, t);
+
+                        REQUIRE(path.m_cost == reference[t]);
+
+                        if (reference[t] != Defs::INFINITY_VALUE)
+                        {
+                            REQUIRE(path.m_vertices.Size() > 0);
+                            CHECK(path.m_vertices[0] == s);
+                            CHECK(path.m_vertices[path.m_vertices.Size() - 1] == t);
+                            CHECK(test::PathCost(staticGraph, path.m_vertices) == path.m_cost);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("ALTIndex on an empty graph")
+{
+    auto graph = test::MakeGraph(0, {});
+    StaticGraph staticGraph(*graph);
+    ALTIndex index(staticGraph, 4);
+
+    CHECK(index.GetNumLandmarks() == 0);
+}
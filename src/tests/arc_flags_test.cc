@@ -0,0 +1,91 @@
+/*
+* Filename: arc_flags_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <cstdio>
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "arc_flags.h"
+
+using namespace geom;
+
+TEST_CASE("ArcFlags matches Graph::Dijkstra")
+{
+    for (auto &graphCase : test::GraphCases())
+    {
+        SUBCASE(graphCase.m_name.c_str())
+        {
+            auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+            StaticGraph staticGraph(*graph);
+
+            ArcFlags::Preprocess(staticGraph, 4, 2);
+            ArcFlags arcFlags(staticGraph);
+
+            REQUIRE(arcFlags.HasFlags());
+
+            for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+            {
+                std::vector<std::size_t> reference = test::ReferenceDistances(*graph, s);
+
+                for (std::size_t t = 0; t < graphCase.m_numVertices; t++)
+                {
+                    Path path = arcFlags.Query(s, t);
+
+                    REQUIRE(path.m_cost == reference[t]);
+
+                    if (reference[t] != Defs::INFINITY_VALUE)
+                    {
+                        REQUIRE(path.m_vertices.Size() > 0);
+                        CHECK(path.m_vertices[0] == s);
+                        CHECK(path.m_vertices[path.m_vertices.Size() - 1] == t);
+                        CHECK(test::PathCost(staticGraph, path.m_vertices) == path.m_cost);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("ArcFlags on a graph without flags")
+{
+    test::GraphCase graphCase = test::GraphCases()[0];
+    auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+    StaticGraph staticGraph(*graph);
+
+    SUBCASE("never preprocessed")
+    {
+        ArcFlags arcFlags(staticGraph);
+
+        CHECK_FALSE(arcFlags.HasFlags());
+        CHECK(arcFlags.Query(0, 1).m_cost == Defs::INFINITY_VALUE);
+    }
+
+    SUBCASE("loaded from a file saved without flags")
+    {
+        const char* fileName = "arc_flags_test.bin";
+        StaticGraph loaded;
+
+        REQUIRE(staticGraph.Save(fileName));
+        REQUIRE(loaded.Load(fileName));
+        remove(fileName);
+
+        ArcFlags arcFlags(loaded);
+
+        CHECK_FALSE(arcFlags.HasFlags());
+        CHECK(arcFlags.Query(0, 1).m_cost == Defs::INFINITY_VALUE);
+    }
+}
+
+TEST_CASE("ArcFlags on an empty graph")
+{
+    auto graph = test::MakeGraph(0, {});
+    StaticGraph staticGraph(*graph);
+
+    ArcFlags::Preprocess(staticGraph, 4);
+    ArcFlags arcFlags(staticGraph);
+
+    CHECK(arcFlags.HasFlags());
+}
@@ -0,0 +1,96 @@
+/*
+* Filename: arc_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "arc.h"
+
+using namespace geom;
+
+TEST_CASE("Arc keeps the head, the edge and the three weights")
+{
+    // The largest weights of the input ranges, and the largest the packed layout holds
+    Arc input(7, 3, 100000000, 100000, 100000);
+    Arc largest(1, 2, (1 << 27) - 1, (1 << 17) - 1, (1 << 17) - 1);
+
+    CHECK(input.GetHead() == 7);
+    CHECK(input.GetEdgeID() == 3);
+    CHECK(input.GetWeight(Defs::YEAR) == 100000000);
+    CHECK(input.GetWeight(Defs::TIME) == 100000);
+    CHECK(input.GetWeight(Defs::COST) == 100000);
+
+    CHECK(largest.GetWeight(Defs::YEAR) == (1 << 27) - 1);
+    CHECK(largest.GetWeight(Defs::TIME) == (1 << 17) - 1);
+    CHECK(largest.GetWeight(Defs::COST) == (1 << 17) - 1);
+
+    CHECK(Arc::Fits(100000000, 100000, 100000));
+
+    if (Arc::PACKED)
+        CHECK(sizeof(Arc) == sizeof(Defs::VertexID) + sizeof(Defs::EdgeID) + sizeof(uint64_t));
+}
+
+TEST_CASE("Graph and StaticGraph fall back to wide weights out of the packed range")
+{
+    auto graph = std::make_unique<Graph>(3, 4);
+
+    for (std::size_t i = 0; i < 3; i++)
+        graph->AddVertex(Vertex(i));
+
+    graph->AddEdge(0, 1, 1, 1, 1);
+    CHECK_FALSE(graph->HasWideWeights());
+
+    graph->AddEdge(0, 1, 1 << 27, 1 << 17, UINT32_MAX);
+    graph->AddEdge(1, 2, 1, 1 << 17, 1);
+    graph->AddEdge(0, 2, 1, (1 << 17) + 5, 1);
+
+    // Wide builds hold any 32-bit weight in the arcs
+    CHECK(graph->HasWideWeights() == Arc::PACKED);
+    CHECK(graph->GetVertex(0)->GetDegree() == 3);
+
+    // The weights read before the fallback are still right
+    const Arc &first = graph->GetVertex(0)->GetAdjacencyList()->At(0);
+    const Arc &large = graph->GetVertex(0)->GetAdjacencyList()->At(1);
+    CHECK(graph->GetWeight(first, Defs::TIME) == 1);
+    CHECK(graph->GetWeight(large, Defs::YEAR) == 1 << 27);
+    CHECK(graph->GetWeight(large, Defs::TIME) == 1 << 17);
+    CHECK(graph->GetWeight(large, Defs::COST) == UINT32_MAX);
+
+    for (double threshold : { 2.0, 0.0 })
+    {
+        graph->SetDenseThreshold(threshold);
+
+        std::vector<std::size_t> distances = test::ReferenceDistances(*graph, 0);
+        CHECK(distances[1] == 1);
+        CHECK(distances[2] == (1 << 17) + 1);
+
+        CHECK(graph->PrimMST(0, Defs::COST).m_totalCost == 2);
+    }
+
+    StaticGraph staticGraph(*graph), loaded;
+    const char* fileName = "arc_test_wide.bin";
+
+    CHECK(staticGraph.IsPacked() == false);
+    REQUIRE(staticGraph.Save(fileName));
+    REQUIRE(loaded.Load(fileName));
+    remove(fileName);
+
+    for (auto *snapshot : { &staticGraph, &loaded })
+    {
+        REQUIRE(snapshot->GetNumArcs() == 8);
+        CHECK(snapshot->GetWeight(1, Defs::YEAR) == 1 << 27);
+
+        for (std::size_t u = 0; u < 3; u++)
+        {
+            AdjacencyList* adjList = graph->GetVertex(u)->GetAdjacencyList();
+
+            for (std::size_t i = 0; i < adjList->Size(); i++)
+            {
+                for (auto edgeInfo : { Defs::YEAR, Defs::TIME, Defs::COST })
+                    CHECK(snapshot->GetWeight(snapshot->FirstArc(u) + i, edgeInfo) == graph->GetWeight(adjList->At(i), edgeInfo));
+            }
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/*
+* Filename: batch_shortest_paths_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <mutex>
+#include <stdexcept>
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "batch_shortest_paths.h"
+
+using namespace geom;
+
+TEST_CASE("BatchShortestPaths matches Graph::Dijkstra")
+{
+    for (auto &graphCase : test::GraphCases())
+    {
+        SUBCASE(graphCase.m_name.c_str())
+        {
+            auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+            StaticGraph staticGraph(*graph);
+            BatchShortestPaths batch(staticGraph, 3);
+            Vector<std::size_t> sources;
+            std::vector<std::vector<std::size_t>> distances(graphCase.m_numVertices);
+            std::mutex mutex;
+
+            for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+                sources.PushBack(s);
+
+            batch.Run(sources, [&](std::size_t source, const ShortestPathTree &tree) {
+                std::vector<std::size_t> sourceDistances(graphCase.m_numVertices);
+
+                for (std::size_t v = 0; v < graphCase.m_numVertices; v++)
+                    sourceDistances[v] = tree.GetDistance(v);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                distances[source] = sourceDistances;
+            });
+
+            for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+                CHECK(distances[s] == test::ReferenceDistances(*graph, s));
+        }
+    }
+}
+
+TEST_CASE("BatchShortestPaths on an empty graph")
+{
+    auto graph = test::MakeGraph(0, {});
+    StaticGraph staticGraph(*graph);
+    BatchShortestPaths batch(staticGraph, 2);
+    std::size_t numTrees = 0;
+
+    batch.Run(Vector<std::size_t>(), [&numTrees](std::size_t, const ShortestPathTree &) { numTrees++; });
+
+    CHECK(numTrees == 0);
+}
+
+TEST_CASE("BatchShortestPaths rethrows the consumer exception")
+{
+    test::GraphCase graphCase = test::GraphCases()[0];
+    auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+    StaticGraph staticGraph(*graph);
+    BatchShortestPaths batch(staticGraph, 4);
+    Vector<std::size_t> sources;
+
+    for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+        sources.PushBack(s);
+
+    // Every worker throws, including the calling thread
+    CHECK_THROWS_AS(batch.Run(sources, [](std::size_t, const ShortestPathTree &) {
+        throw std::runtime_error("consumer failed");
+    }), std::runtime_error);
+
+    // Only one source throws, the others keep running until they see the stop
+    CHECK_THROWS_AS(batch.Run(sources, [](std::size_t source, const ShortestPathTree &) {
+        if (source == 7)
+            throw std::runtime_error("consumer failed");
+    }), std::runtime_error);
+}
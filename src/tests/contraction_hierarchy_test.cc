@@ -0,0 +1,104 @@
+/*
+* Filename: contraction_hierarchy_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <cstdio>
+#include <unistd.h>
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "contraction_hierarchy.h"
+
+using namespace geom;
+
+TEST_CASE("ContractionHierarchy matches Graph::Dijkstra")
+{
+    for (auto &graphCase : test::GraphCases())
+    {
+        SUBCASE(graphCase.m_name.c_str())
+        {
+            auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+            StaticGraph staticGraph(*graph);
+            ContractionHierarchy hierarchy;
+
+            hierarchy.Build(staticGraph);
+
+            for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+            {
+                std::vector<std::size_t> reference = test::ReferenceDistances(*graph, s);
+
+                for (std::size_t t = 0; t < graphCase.m_numVertices; t++)
+                {
+                    Path path = hierarchy.Query(s, t);
+
+                    REQUIRE(path.m_cost == reference[t]);
+
+                    if (reference[t] != Defs::INFINITY_VALUE)
+                    {
+                        REQUIRE(path.m_vertices.Size() > 0);
+                        CHECK(path.m_vertices[0] == s);
+                        CHECK(path.m_vertices[path.m_vertices.Size() - 1] == t);
+                        CHECK(test::PathCost(staticGraph, path.m_vertices) == path.m_cost);
+                    }
+                }
+            }
+
+            CHECK(hierarchy.Verify(*graph, 200) == 0);
+        }
+    }
+}
+
+TEST_CASE("ContractionHierarchy on an empty graph")
+{
+    auto graph = test::MakeGraph(0, {});
+    StaticGraph staticGraph(*graph);
+    ContractionHierarchy hierarchy;
+
+    hierarchy.Build(staticGraph);
+
+    CHECK(hierarchy.GetNumArcs() == 0);
+    CHECK(hierarchy.Verify(*graph, 10) == 0);
+}
+
+TEST_CASE("ContractionHierarchy Save and Load")
+{
+    test::GraphCase graphCase = test::GraphCases()[0];
+    auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+    StaticGraph staticGraph(*graph);
+    ContractionHierarchy hierarchy, loaded;
+    const char* fileName = "ch_test.bin";
+
+    hierarchy.Build(staticGraph);
+    REQUIRE(hierarchy.Save(fileName));
+
+    SUBCASE("round trip")
+    {
+        REQUIRE(loaded.Load(fileName, staticGraph));
+        CHECK(loaded.GetNumArcs() == hierarchy.GetNumArcs());
+        CHECK(loaded.Verify(*graph, 200) == 0);
+    }
+
+    SUBCASE("another graph is rejected")
+    {
+        auto other = test::MakeGraph(graphCase.m_numVertices + 1, graphCase.m_edges);
+        StaticGraph otherStatic(*other);
+
+        CHECK_FALSE(loaded.Load(fileName, otherStatic));
+    }
+
+    SUBCASE("a truncated file is rejected")
+    {
+        FILE* file = fopen(fileName, "r+b");
+        REQUIRE(file != nullptr);
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fclose(file);
+        REQUIRE(truncate(fileName, size - 8) == 0);
+
+        CHECK_FALSE(loaded.Load(fileName, staticGraph));
+    }
+
+    remove(fileName);
+}
@@ -0,0 +1,99 @@
+/*
+* Filename: dary_heap_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "doctest.h"
+#include "dary_heap.h"
+
+TEST_CASE("MinOfEight kernels agree")
+{
+    std::mt19937_64 generator(5);
+    uint64_t keys[8];
+
+    for (std::size_t i = 0; i < 10000; i++)
+    {
+        // Few distinct keys, so that ties are common and the first minimum must be picked
+        for (auto &key : keys)
+            key = generator() % (i % 2 == 0 ? 4 : heap::DaryHeap<int>::EMPTY_KEY);
+
+        std::size_t expected = std::min_element(keys, keys + 8) - keys;
+
+        REQUIRE(heap::MinOfEightScalar(keys) == expected);
+
+        if (__builtin_cpu_supports("avx2"))
+            REQUIRE(heap::MinOfEightAVX2(keys) == expected);
+    }
+}
+
+TEST_CASE("DaryHeap dequeues in key order")
+{
+    for (bool useSIMD : { false, true })
+    {
+        SUBCASE(useSIMD ? "AVX2" : "scalar")
+        {
+            heap::DaryHeap<std::size_t> dHeap(useSIMD);
+            std::mt19937_64 generator(11);
+            std::vector<uint64_t> dequeued, expected;
+
+            for (std::size_t i = 0; i < 5000; i++)
+            {
+                uint64_t key = generator() % 1000;
+
+                dHeap.Enqueue(heap::DaryHeap<std::size_t>::Entry(key, i));
+                expected.push_back(key);
+
+                // Batches exercise the bottom-up heapify
+                if (i % 100 == 99)
+                {
+                    std::vector<heap::DaryHeap<std::size_t>::Entry> batch;
+
+                    for (std::size_t j = 0; j < 50; j++)
+                    {
+                        batch.emplace_back(generator() % 1000, j);
+                        expected.push_back(batch.back().first);
+                    }
+
+                    dHeap.EnqueueBatch(batch.begin(), batch.end());
+                }
+            }
+
+            CHECK(dHeap.Size() == expected.size());
+
+            while (not dHeap.IsEmpty())
+                dequeued.push_back(dHeap.Dequeue().first);
+
+            std::sort(expected.begin(), expected.end());
+            CHECK(dequeued == expected);
+        }
+    }
+}
+
+TEST_CASE("DaryHeap dequeues equal keys by value")
+{
+    for (bool useSIMD : { false, true })
+    {
+        SUBCASE(useSIMD ? "AVX2" : "scalar")
+        {
+            heap::DaryHeap<uint32_t> dHeap(useSIMD);
+            std::mt19937_64 generator(13);
+            std::vector<heap::DaryHeap<uint32_t>::Entry> expected;
+
+            for (uint32_t i = 0; i < 3000; i++)
+            {
+                expected.emplace_back(generator() % 5, generator() % 100000);
+                dHeap.Enqueue(expected.back());
+            }
+
+            std::sort(expected.begin(), expected.end());
+
+            for (auto &entry : expected)
+                REQUIRE(dHeap.Dequeue() == entry);
+        }
+    }
+}
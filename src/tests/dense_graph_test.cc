@@ -0,0 +1,95 @@
+/*
+* Filename: dense_graph_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "doctest.h"
+#include "test_graphs.h"
+
+using namespace geom;
+
+namespace
+{
+    // Shortest path tree of a query, copied out of its workspace
+    struct Tree
+    {
+        std::vector<std::size_t> m_distances;
+        std::vector<Defs::EdgeID> m_parents; // ID of the parent edges, NO_PARENT for none
+        uint32_t m_maxYear;
+    };
+
+    constexpr Defs::EdgeID NO_PARENT = ~Defs::EdgeID(0);
+
+    Tree ShortestPathTree(Graph &graph, Defs::VertexID source, Defs::EDGE_INFO edgeInfo)
+    {
+        ShortestPathResult result = graph.Dijkstra(source, edgeInfo);
+        Tree tree { std::vector<std::size_t>(result.m_distances.begin(), result.m_distances.end()), { },
+                    result.m_maxYear };
+
+        for (Edge* edge : result.m_parentEdges)
+            tree.m_parents.push_back(edge == nullptr ? NO_PARENT : edge->GetID());
+
+        return tree;
+    }
+}
+
+TEST_CASE("Dense engine builds the same trees as the heaps")
+{
+    std::vector<test::GraphCase> cases = test::GraphCases();
+
+    // Few distinct weights, so most vertices have several shortest paths
+    cases.push_back(test::GraphCase { "ties", 50, test::RandomEdges(50, 400, 1, 3, 5) });
+
+    for (auto &graphCase : cases)
+    {
+        SUBCASE(graphCase.m_name.c_str())
+        {
+            auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+
+            for (auto edgeInfo : { Defs::YEAR, Defs::TIME, Defs::COST })
+            {
+                for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+                {
+                    graph->SetDenseThreshold(0);
+                    Tree dense = ShortestPathTree(*graph, s, edgeInfo);
+                    SpanningTreeResult denseMST = graph->PrimMST(s, edgeInfo);
+                    uint32_t denseBottleneck = denseMST.m_bottleneckYear;
+                    std::size_t denseCost = denseMST.m_totalCost;
+
+                    graph->SetDenseThreshold(2);
+
+                    for (auto queueType : { Graph::BINARY_HEAP, Graph::DARY_HEAP })
+                    {
+                        graph->SetDijkstraQueue(queueType);
+                        Tree heap = ShortestPathTree(*graph, s, edgeInfo);
+
+                        REQUIRE(heap.m_distances == dense.m_distances);
+                        CHECK(heap.m_parents == dense.m_parents);
+                        CHECK(heap.m_maxYear == dense.m_maxYear);
+                    }
+
+                    // The weight of a minimum spanning tree, and its bottleneck, do not
+                    // depend on the ties
+                    SpanningTreeResult heapMST = graph->PrimMST(s, edgeInfo);
+
+                    if (edgeInfo == Defs::YEAR)
+                        CHECK(heapMST.m_bottleneckYear == denseBottleneck);
+                    if (edgeInfo == Defs::COST)
+                        CHECK(heapMST.m_totalCost == denseCost);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Dense engine sees the edges added after a query")
+{
+    auto graph = test::MakeGraph(3, { { 0, 1, 1, 10, 1 }, { 1, 2, 1, 10, 1 } });
+
+    graph->SetDenseThreshold(0);
+    CHECK(test::ReferenceDistances(*graph, 0)[2] == 20);
+
+    graph->AddEdge(0, 2, 1, 5, 1);
+    CHECK(test::ReferenceDistances(*graph, 0)[2] == 5);
+}
@@ -0,0 +1,74 @@
+/*
+* Filename: distance_table_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "distance_table.h"
+
+using namespace geom;
+
+TEST_CASE("DistanceTable matches Graph::Dijkstra")
+{
+    for (auto &graphCase : test::GraphCases())
+    {
+        for (std::size_t numThreads : { 1, 3 })
+        {
+            std::string name = graphCase.m_name + ", " + std::to_string(numThreads) + " threads";
+
+            SUBCASE(name.c_str())
+            {
+                auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+                StaticGraph staticGraph(*graph);
+                DistanceTable table(staticGraph, numThreads);
+                Vector<std::size_t> origins, destinations;
+
+                // Every vertex is an origin, and every third one a destination, the first twice
+                for (std::size_t v = 0; v < graphCase.m_numVertices; v++)
+                    origins.PushBack(v);
+
+                for (std::size_t v = 0; v < graphCase.m_numVertices; v += 3)
+                    destinations.PushBack(v);
+                destinations.PushBack(0);
+
+                // The second round reuses the stamps of the first
+                for (std::size_t round = 0; round < 2; round++)
+                {
+                    table.Compute(origins, destinations);
+
+                    REQUIRE(table.GetNumOrigins() == origins.Size());
+                    REQUIRE(table.GetNumDestinations() == destinations.Size());
+
+                    for (std::size_t i = 0; i < origins.Size(); i++)
+                    {
+                        std::vector<std::size_t> reference = test::ReferenceDistances(*graph, origins[i]);
+
+                        for (std::size_t j = 0; j < destinations.Size(); j++)
+                        {
+                            if (reference[destinations[j]] == Defs::INFINITY_VALUE)
+                                REQUIRE(table.GetDistance(i, j) == DistanceTable::UNREACHABLE);
+                            else
+                                REQUIRE(table.GetDistance(i, j) == reference[destinations[j]]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("DistanceTable without origins or destinations")
+{
+    auto graph = test::MakeGraph(0, {});
+    StaticGraph staticGraph(*graph);
+    DistanceTable table(staticGraph, 2);
+    Vector<std::size_t> none;
+
+    table.Compute(none, none);
+
+    CHECK(table.GetNumOrigins() == 0);
+    CHECK(table.GetNumDestinations() == 0);
+    CHECK(table.GetStats().m_numSettled == 0);
+}
@@ -0,0 +1,59 @@
+/*
+* Filename: graph_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "doctest.h"
+#include "test_graphs.h"
+
+using namespace geom;
+
+TEST_CASE("Graph takes the edges from its arena")
+{
+    const std::size_t numVertices = 1000;
+    std::vector<test::EdgeSpec> edges = test::RandomEdges(numVertices, 20000, 1, 1000, 7);
+    std::vector<std::size_t> degrees(numVertices, 0);
+    Graph graph(numVertices, edges.size());
+
+    for (std::size_t i = 0; i < numVertices; i++)
+        graph.AddVertex(Vertex(i));
+
+    for (auto &edge : edges)
+    {
+        degrees[edge.m_u]++;
+        degrees[edge.m_v]++;
+    }
+
+    for (std::size_t i = 0; i < numVertices; i++)
+        graph.ReserveDegree(i, degrees[i]);
+
+    std::size_t numAllocations = test::GetNumAllocations();
+
+    for (auto &edge : edges)
+        graph.AddEdge(edge.m_u, edge.m_v, edge.m_year, edge.m_time, edge.m_cost);
+
+    // No edge, arc or edge array storage comes from the heap
+    CHECK(test::GetNumAllocations() == numAllocations);
+
+    // One arena allocation for the edge array, one per adjacency list (every vertex has an
+    // edge) and one per edge, less the ones that needed an arena block. Growing the lists
+    // would take more. The same allocations on an arena of the same block size take the
+    // same blocks
+    Arena expected;
+
+    expected.Allocate(edges.size() * sizeof(Edge*), alignof(Edge*));
+    for (std::size_t i = 0; i < numVertices; i++)
+        expected.Allocate(degrees[i] * sizeof(Arc), alignof(Arc));
+    for (std::size_t i = 0; i < edges.size(); i++)
+        expected.Allocate(sizeof(Edge), alignof(Edge));
+
+    CHECK(graph.GetNumArenaBlocks() == expected.GetNumBlocks());
+    CHECK(graph.GetNumMallocsAvoided() == edges.size() + 1 + numVertices - expected.GetNumBlocks());
+
+    for (std::size_t i = 0; i < numVertices; i++)
+        REQUIRE(graph.GetVertex(i)->GetAdjacencyList()->Size() == degrees[i]);
+
+    std::vector<std::size_t> reference = test::ReferenceDistances(graph, 0);
+    CHECK(reference[numVertices - 1] != Defs::INFINITY_VALUE);
+}
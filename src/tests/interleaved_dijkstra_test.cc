@@ -0,0 +1,85 @@
+/*
+* Filename: interleaved_dijkstra_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <stdexcept>
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "interleaved_dijkstra.h"
+
+using namespace geom;
+
+TEST_CASE("InterleavedDijkstra matches Graph::Dijkstra")
+{
+    for (std::size_t numInFlight : { 1, 3, 8 })
+    {
+        for (auto &graphCase : test::GraphCases())
+        {
+            std::string name = graphCase.m_name + ", " + std::to_string(numInFlight) + " in flight";
+
+            SUBCASE(name.c_str())
+            {
+                auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+                StaticGraph staticGraph(*graph);
+                InterleavedDijkstra engine(staticGraph, numInFlight);
+                Vector<std::size_t> sources;
+                std::vector<std::size_t> numResults(graphCase.m_numVertices, 0);
+
+                for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+                    sources.PushBack(s);
+
+                engine.Run(sources, [&](std::size_t source, const Vector<std::size_t> &dist) {
+                    std::vector<std::size_t> reference = test::ReferenceDistances(*graph, source);
+
+                    for (std::size_t v = 0; v < graphCase.m_numVertices; v++)
+                        REQUIRE(dist[v] == reference[v]);
+
+                    numResults[source]++;
+                });
+
+                for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+                    CHECK(numResults[s] == 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("InterleavedDijkstra on an empty graph")
+{
+    auto graph = test::MakeGraph(0, {});
+    StaticGraph staticGraph(*graph);
+    InterleavedDijkstra engine(staticGraph, 4);
+    std::size_t numResults = 0;
+
+    engine.Run(Vector<std::size_t>(), [&numResults](std::size_t, const Vector<std::size_t> &) { numResults++; });
+
+    CHECK(numResults == 0);
+}
+
+TEST_CASE("InterleavedDijkstra after a consumer exception")
+{
+    test::GraphCase graphCase = test::GraphCases()[0];
+    auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+    StaticGraph staticGraph(*graph);
+    InterleavedDijkstra engine(staticGraph, 4);
+    Vector<std::size_t> sources;
+
+    for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+        sources.PushBack(s);
+
+    // The first query to end throws while the other three are still in flight
+    CHECK_THROWS_AS(engine.Run(sources, [](std::size_t, const Vector<std::size_t> &) {
+        throw std::runtime_error("consumer failed");
+    }), std::runtime_error);
+
+    // The dropped queries leave nothing behind for the next run
+    engine.Run(sources, [&](std::size_t source, const Vector<std::size_t> &dist) {
+        std::vector<std::size_t> reference = test::ReferenceDistances(*graph, source);
+
+        for (std::size_t v = 0; v < graphCase.m_numVertices; v++)
+            REQUIRE(dist[v] == reference[v]);
+    });
+}
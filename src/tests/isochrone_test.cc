@@ -0,0 +1,66 @@
+/*
+* Filename: isochrone_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <algorithm>
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "isochrone.h"
+
+using namespace geom;
+
+TEST_CASE("Isochrone matches Graph::Dijkstra with a limit")
+{
+    for (auto &graphCase : test::GraphCases())
+    {
+        SUBCASE(graphCase.m_name.c_str())
+        {
+            auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+            StaticGraph staticGraph(*graph);
+            Isochrone isochrone(staticGraph);
+
+            for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+            {
+                std::vector<std::size_t> reference = test::ReferenceDistances(*graph, s);
+
+                // Alternating large and small limits, so each reset follows a larger query
+                for (std::size_t limit : { std::size_t(1000000), std::size_t(0), std::size_t(40), std::size_t(7) })
+                {
+                    std::vector<Defs::VertexID> reached = isochrone.Query(s, limit);
+                    std::size_t expected = std::count_if(reference.begin(), reference.end(),
+                                                         [limit](std::size_t dist) { return dist <= limit; });
+
+                    // Each vertex within the limit once
+                    std::vector<Defs::VertexID> distinct = reached;
+                    std::sort(distinct.begin(), distinct.end());
+                    REQUIRE(std::unique(distinct.begin(), distinct.end()) == distinct.end());
+                    REQUIRE(reached.size() == expected);
+                    REQUIRE(reached.size() > 0);
+                    CHECK(reached[0] == s);
+                    CHECK(isochrone.GetNumTouched() >= reached.size());
+
+                    for (std::size_t i = 0; i < reached.size(); i++)
+                    {
+                        REQUIRE(reference[reached[i]] <= limit);
+                        CHECK(isochrone.GetDistance(reached[i]) == reference[reached[i]]);
+
+                        if (i > 0)
+                            CHECK(reference[reached[i - 1]] <= reference[reached[i]]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Isochrone on an empty graph")
+{
+    auto graph = test::MakeGraph(0, {});
+    StaticGraph staticGraph(*graph);
+    Isochrone isochrone(staticGraph);
+
+    CHECK(isochrone.GetNumTouched() == 0);
+}
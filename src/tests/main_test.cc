@@ -0,0 +1,58 @@
+/*
+* Filename: main_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "test_graphs.h"
+
+// Number of calls to the global operator new made by the test program
+static std::atomic<std::size_t> numAllocations(0);
+
+void* operator new(std::size_t size)
+{
+    numAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    void* pointer = malloc(size == 0 ? 1 : size);
+
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+
+    return pointer;
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    numAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    // aligned_alloc needs a size multiple of the alignment
+    std::size_t align = static_cast<std::size_t>(alignment);
+    void* pointer = aligned_alloc(align, (size + align - 1) / align * align + (size == 0 ? align : 0));
+
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept
+{
+    free(pointer);
+}
+
+std::size_t geom::test::GetNumAllocations()
+{
+    return numAllocations.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,130 @@
+/*
+* Filename: multi_source_simd_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "multi_source_simd.h"
+
+using namespace geom;
+
+static const MultiSourceSIMD::KERNEL KERNELS[] = {
+    MultiSourceSIMD::SCALAR, MultiSourceSIMD::AVX2, MultiSourceSIMD::AVX512
+};
+
+static const char* KERNEL_NAMES[] = { "scalar", "avx2", "avx512" };
+
+TEST_CASE("MultiSourceSIMD matches Graph::Dijkstra")
+{
+    for (auto kernel : KERNELS)
+    {
+        for (auto &graphCase : test::GraphCases())
+        {
+            std::string name = graphCase.m_name + ", " + KERNEL_NAMES[kernel];
+
+            SUBCASE(name.c_str())
+            {
+                auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+                StaticGraph staticGraph(*graph);
+                MultiSourceSIMD engine(staticGraph, Defs::EDGE_INFO::TIME, kernel);
+                std::vector<std::size_t> sources;
+
+                // The CPU may not support the kernel, the engine then uses a narrower one
+                CHECK(engine.GetKernel() <= kernel);
+
+                for (std::size_t s = 0; s < graphCase.m_numVertices; s++)
+                    sources.push_back(s);
+
+                for (std::size_t first = 0; first < sources.size(); first += engine.GetNumLanes())
+                {
+                    std::size_t numSources = std::min(engine.GetNumLanes(), sources.size() - first);
+
+                    REQUIRE(engine.Run(&sources[first], numSources));
+
+                    for (std::size_t lane = 0; lane < numSources; lane++)
+                    {
+                        std::vector<std::size_t> reference = test::ReferenceDistances(*graph, sources[first + lane]);
+
+                        for (std::size_t v = 0; v < graphCase.m_numVertices; v++)
+                            REQUIRE(engine.GetDistance(lane, v) == reference[v]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("MultiSourceSIMD on an empty graph")
+{
+    auto graph = test::MakeGraph(0, {});
+    StaticGraph staticGraph(*graph);
+    MultiSourceSIMD engine(staticGraph);
+
+    CHECK(engine.Run(nullptr, 0));
+}
+
+/**
+ * @brief Path 0 - 1 - ... whose edges have the given years, the largest weights that the
+ *        packed arcs hold. The distances by year get close to the 32-bit limit
+ **/
+static std::unique_ptr<Graph> MakeYearPath(const std::vector<uint32_t> &years)
+{
+    std::vector<test::EdgeSpec> edges;
+
+    for (std::size_t i = 0; i < years.size(); i++)
+        edges.push_back({ Defs::VertexID(i), Defs::VertexID(i + 1), years[i], 1, 1 });
+
+    return test::MakeGraph(years.size() + 1, edges);
+}
+
+TEST_CASE("MultiSourceSIMD saturates in every kernel")
+{
+    // 31 edges of weight 2^27 - 1 take vertex 31 to UNREACHABLE - (2^27 + 30). The two
+    // edges after it split that rest so that no arc back towards the source overflows
+    const uint32_t heavy = (uint32_t(1) << 27) - 1;
+    const uint32_t a = uint32_t(1) << 26;
+    const uint32_t b = (uint32_t(1) << 26) + 30;
+    std::vector<uint32_t> years(31, heavy);
+
+    for (auto kernel : KERNELS)
+    {
+        SUBCASE(KERNEL_NAMES[kernel])
+        {
+            std::size_t source = 0;
+
+            // Every sum is below UNREACHABLE
+            std::vector<uint32_t> fitsYears = years;
+            fitsYears.push_back(a);
+            auto fits = MakeYearPath(fitsYears);
+            StaticGraph fitsStatic(*fits);
+            MultiSourceSIMD fitsEngine(fitsStatic, Defs::EDGE_INFO::YEAR, kernel);
+
+            CHECK(fitsEngine.Run(&source, 1));
+            CHECK(fitsEngine.GetDistance(0, 32) == std::size_t(UINT32_MAX) - b);
+
+            // The path to 33 sums exactly UNREACHABLE, which does not fit even though it
+            // does not wrap
+            std::vector<uint32_t> equalYears = fitsYears;
+            equalYears.push_back(b);
+            auto equal = MakeYearPath(equalYears);
+            StaticGraph equalStatic(*equal);
+            MultiSourceSIMD equalEngine(equalStatic, Defs::EDGE_INFO::YEAR, kernel);
+
+            CHECK_FALSE(equalEngine.Run(&source, 1));
+            CHECK(equalEngine.GetDistance(0, 32) == std::size_t(UINT32_MAX) - b);
+            CHECK(equalEngine.GetDistance(0, 33) == Defs::INFINITY_VALUE);
+
+            // The path to 33 sums 2^32, which wraps around
+            std::vector<uint32_t> wrapsYears = fitsYears;
+            wrapsYears.push_back(b + 1);
+            auto wraps = MakeYearPath(wrapsYears);
+            StaticGraph wrapsStatic(*wraps);
+            MultiSourceSIMD wrapsEngine(wrapsStatic, Defs::EDGE_INFO::YEAR, kernel);
+
+            CHECK_FALSE(wrapsEngine.Run(&source, 1));
+            CHECK(wrapsEngine.GetDistance(0, 33) == Defs::INFINITY_VALUE);
+        }
+    }
+}
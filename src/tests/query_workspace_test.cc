@@ -0,0 +1,86 @@
+/*
+* Filename: query_workspace_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "doctest.h"
+#include "test_graphs.h"
+
+using namespace geom;
+
+TEST_CASE("Warm queries allocate nothing")
+{
+    const std::size_t numVertices = 300;
+    auto graph = test::MakeGraph(numVertices, test::RandomEdges(numVertices, 1500, 1, 1000, 9));
+    WorkspacePool* pool = graph->GetWorkspacePool();
+
+    // 1500 edges are below the default density, 0 makes every query use the matrices
+    for (double threshold : { 0.3, 0.0 })
+    {
+        SUBCASE(threshold > 0 ? "heap engines" : "matrix engine")
+        {
+            graph->SetDenseThreshold(threshold);
+
+            QueryWorkspace* workspace = pool->Acquire();
+            std::size_t numAllocations = workspace->GetNumAllocations();
+
+            // Warm up with a query of each kind
+            for (auto edgeInfo : { Defs::YEAR, Defs::TIME, Defs::COST })
+            {
+                graph->Dijkstra(0, edgeInfo, *workspace);
+                graph->PrimMST(0, edgeInfo, *workspace);
+            }
+
+            CHECK(workspace->GetNumAllocations() > numAllocations);
+
+            std::size_t numHeapAllocations = test::GetNumAllocations();
+            numAllocations = workspace->GetNumAllocations();
+
+            for (std::size_t s = 0; s < numVertices; s += 7)
+            {
+                for (auto edgeInfo : { Defs::YEAR, Defs::TIME, Defs::COST })
+                {
+                    graph->Dijkstra(s, edgeInfo, *workspace);
+                    graph->PrimMST(s, edgeInfo, *workspace);
+                }
+            }
+
+            // The global operator new was not called, and the counter agrees
+            CHECK(test::GetNumAllocations() == numHeapAllocations);
+            CHECK(workspace->GetNumAllocations() == numAllocations);
+
+            pool->Release(workspace);
+        }
+    }
+}
+
+TEST_CASE("Each growing buffer is counted")
+{
+    auto graph = test::MakeGraph(2000, test::RandomEdges(2000, 8000, 1, 10, 11));
+    QueryWorkspace* workspace = graph->GetWorkspacePool()->Acquire();
+
+    graph->PrimMST(0, Defs::COST, *workspace);
+    std::size_t numAllocations = workspace->GetNumAllocations();
+
+    // The buffers of Prim are warm
+    graph->PrimMST(0, Defs::COST, *workspace);
+    CHECK(workspace->GetNumAllocations() == numAllocations);
+
+    // The queue of Dijkstra grows, while the buffers of Prim keep their capacity
+    graph->Dijkstra(0, Defs::TIME, *workspace);
+    CHECK(workspace->GetNumAllocations() > numAllocations);
+
+    graph->GetWorkspacePool()->Release(workspace);
+}
+
+TEST_CASE("A new workspace counts the buffers of its constructor")
+{
+    for (std::size_t numVertices : { 0, 1000 })
+    {
+        std::size_t numHeapAllocations = test::GetNumAllocations();
+        QueryWorkspace workspace(numVertices);
+
+        CHECK(workspace.GetNumAllocations() == test::GetNumAllocations() - numHeapAllocations);
+    }
+}
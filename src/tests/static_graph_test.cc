@@ -0,0 +1,167 @@
+/*
+* Filename: static_graph_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include <cstdio>
+#include <unistd.h>
+#include <type_traits>
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "static_graph.h"
+#include "shortest_path_tree.h"
+
+using namespace geom;
+
+// The IDs follow the width of the build (make ID_BITS=64), they are never narrowed
+static_assert(std::is_same_v<decltype(StaticGraph().FirstArc(0)), Defs::EdgeID>);
+static_assert(std::is_same_v<decltype(StaticGraph().GetHead(0)), Defs::VertexID>);
+static_assert(std::is_same_v<decltype(StaticGraph().GetEdgeID(0)), Defs::EdgeID>);
+static_assert(std::is_same_v<decltype(ShortestPathTree(StaticGraph()).GetParentArc(0)), Defs::EdgeID>);
+
+TEST_CASE("StaticGraph keeps the arcs of the Graph")
+{
+    for (auto &graphCase : test::GraphCases())
+    {
+        SUBCASE(graphCase.m_name.c_str())
+        {
+            auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+            StaticGraph staticGraph(*graph);
+
+            REQUIRE(staticGraph.GetNumVertices() == graphCase.m_numVertices);
+            CHECK(staticGraph.GetNumArcs() == 2 * graphCase.m_edges.size());
+
+            for (std::size_t u = 0; u < graphCase.m_numVertices; u++)
+            {
+                AdjacencyList* adjList = graph->GetVertex(u)->GetAdjacencyList();
+
+                REQUIRE(staticGraph.FirstArc(u + 1) - staticGraph.FirstArc(u) == adjList->Size());
+
+                for (std::size_t i = 0; i < adjList->Size(); i++)
+                {
+                    Defs::EdgeID arc = staticGraph.FirstArc(u) + i;
+                    const test::EdgeSpec &edge = graphCase.m_edges[staticGraph.GetEdgeID(arc)];
+
+                    CHECK(staticGraph.GetHead(arc) == (edge.m_u == u ? edge.m_v : edge.m_u));
+                    CHECK(staticGraph.GetWeight(arc, Defs::YEAR) == edge.m_year);
+                    CHECK(staticGraph.GetWeight(arc, Defs::TIME) == edge.m_time);
+                    CHECK(staticGraph.GetWeight(arc, Defs::COST) == edge.m_cost);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("StaticGraph Save and Load")
+{
+    test::GraphCase graphCase = test::GraphCases()[0];
+    auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+    StaticGraph staticGraph(*graph), loaded;
+    const char* fileName = "static_graph_test.bin";
+
+    // Offsets of the sizes and of the first arc in the file
+    const long sizesOffset = 4 * sizeof(uint32_t);
+    const long arcsOffset = sizesOffset + 4 * sizeof(uint64_t) + (staticGraph.GetNumVertices() + 1) * sizeof(Defs::EdgeID);
+
+    REQUIRE(staticGraph.Save(fileName));
+
+    // Overwrite a value of the saved file
+    auto patch = [fileName](long offset, const void* value, std::size_t size) {
+        FILE* file = fopen(fileName, "r+b");
+        REQUIRE(file != nullptr);
+        fseek(file, offset, SEEK_SET);
+        REQUIRE(fwrite(value, size, 1, file) == 1);
+        fclose(file);
+    };
+
+    SUBCASE("round trip")
+    {
+        REQUIRE(loaded.Load(fileName));
+
+        REQUIRE(loaded.GetNumArcs() == staticGraph.GetNumArcs());
+        CHECK(loaded.GetNumVertices() == staticGraph.GetNumVertices());
+        CHECK(loaded.GetNumEdges() == staticGraph.GetNumEdges());
+
+        for (std::size_t u = 0; u <= staticGraph.GetNumVertices(); u++)
+            CHECK(loaded.FirstArc(u) == staticGraph.FirstArc(u));
+
+        for (std::size_t arc = 0; arc < staticGraph.GetNumArcs(); arc++)
+        {
+            CHECK(loaded.GetHead(arc) == staticGraph.GetHead(arc));
+            CHECK(loaded.GetEdgeID(arc) == staticGraph.GetEdgeID(arc));
+            CHECK(loaded.GetWeight(arc, Defs::TIME) == staticGraph.GetWeight(arc, Defs::TIME));
+        }
+    }
+
+    SUBCASE("a truncated file is rejected")
+    {
+        FILE* file = fopen(fileName, "rb");
+        REQUIRE(file != nullptr);
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fclose(file);
+        REQUIRE(truncate(fileName, size - 8) == 0);
+
+        CHECK_FALSE(loaded.Load(fileName));
+    }
+
+    SUBCASE("huge sizes are rejected before allocating")
+    {
+        uint64_t numArcs = uint64_t(1) << 60;
+        patch(sizesOffset + 2 * sizeof(uint64_t), &numArcs, sizeof(numArcs));
+
+        CHECK_FALSE(loaded.Load(fileName));
+    }
+
+    SUBCASE("an arc to a missing vertex is rejected")
+    {
+        Defs::VertexID head = staticGraph.GetNumVertices();
+        patch(arcsOffset, &head, sizeof(head));
+
+        CHECK_FALSE(loaded.Load(fileName));
+    }
+
+    SUBCASE("arc ranges out of order are rejected")
+    {
+        Defs::EdgeID firstArc = staticGraph.GetNumArcs() + 1;
+        patch(sizesOffset + 4 * sizeof(uint64_t) + sizeof(Defs::EdgeID), &firstArc, sizeof(firstArc));
+
+        CHECK_FALSE(loaded.Load(fileName));
+    }
+
+    SUBCASE("a failed Load leaves the graph unchanged")
+    {
+        REQUIRE(loaded.Load(fileName));
+        REQUIRE(truncate(fileName, arcsOffset) == 0);
+
+        CHECK_FALSE(loaded.Load(fileName));
+        CHECK(loaded.GetNumVertices() == staticGraph.GetNumVertices());
+        CHECK(loaded.GetNumArcs() == staticGraph.GetNumArcs());
+        CHECK(loaded.GetHead(0) == staticGraph.GetHead(0));
+    }
+
+    remove(fileName);
+}
+
+TEST_CASE("StaticGraph Load rejects region ids out of range")
+{
+    test::GraphCase graphCase = test::GraphCases()[0];
+    auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+    StaticGraph staticGraph(*graph), loaded;
+    const char* fileName = "static_graph_regions_test.bin";
+
+    staticGraph.ResetArcFlags(4, Defs::TIME);
+    staticGraph.SetRegion(0, 3);
+    REQUIRE(staticGraph.Save(fileName));
+    REQUIRE(loaded.Load(fileName));
+    CHECK(loaded.GetNumRegions() == 4);
+    CHECK(loaded.GetRegion(0) == 3);
+
+    staticGraph.SetRegion(1, 4);
+    REQUIRE(staticGraph.Save(fileName));
+    CHECK_FALSE(loaded.Load(fileName));
+
+    remove(fileName);
+}
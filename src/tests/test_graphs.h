@@ -0,0 +1,172 @@
+/*
+* Filename: test_graphs.h
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#ifndef TEST_GRAPHS_H_
+#define TEST_GRAPHS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "graph.h"
+#include "static_graph.h"
+
+namespace geom
+{
+    namespace test
+    {
+        /**
+         * @return Number of calls to the global operator new so far, counted by the hook
+         *         of main_test.cc
+         **/
+        std::size_t GetNumAllocations();
+
+        // Edge of a test graph, with 0-based vertex IDs
+        struct EdgeSpec
+        {
+            Defs::VertexID m_u, m_v;
+            uint32_t m_year, m_time, m_cost;
+        };
+
+        // Small graph checked by the tests of every engine
+        struct GraphCase
+        {
+            std::string m_name;
+            std::size_t m_numVertices;
+            std::vector<EdgeSpec> m_edges;
+        };
+
+        /**
+         * @return Graph with the given vertices and edges
+         **/
+        inline std::unique_ptr<Graph> MakeGraph(std::size_t numVertices, const std::vector<EdgeSpec> &edges)
+        {
+            auto graph = std::make_unique<Graph>(numVertices, edges.size());
+
+            std::vector<std::size_t> degrees(numVertices, 0);
+
+            for (std::size_t i = 0; i < numVertices; i++)
+                graph->AddVertex(Vertex(i));
+
+            for (auto &edge : edges)
+            {
+                degrees[edge.m_u]++;
+                degrees[edge.m_v]++;
+            }
+
+            for (std::size_t i = 0; i < numVertices; i++)
+                graph->ReserveDegree(i, degrees[i]);
+
+            for (auto &edge : edges)
+                graph->AddEdge(edge.m_u, edge.m_v, edge.m_year, edge.m_time, edge.m_cost);
+
+            return graph;
+        }
+
+        /**
+         * @brief Random edges: a random spanning tree of the first numConnected vertices,
+         *        then edges between any of them, parallel edges included. The remaining
+         *        vertices are isolated
+         * @param minWeight, maxWeight Range of the three weights
+         **/
+        inline std::vector<EdgeSpec> RandomEdges(std::size_t numConnected, std::size_t numEdges, uint32_t minWeight,
+                                                 uint32_t maxWeight, uint32_t seed)
+        {
+            std::mt19937 generator(seed);
+            std::uniform_int_distribution<uint32_t> weight(minWeight, maxWeight);
+            std::vector<EdgeSpec> edges;
+
+            for (std::size_t i = 1; i < numConnected; i++)
+            {
+                edges.push_back(EdgeSpec { Defs::VertexID(i), Defs::VertexID(generator() % i), weight(generator),
+                                           weight(generator), weight(generator) });
+            }
+
+            while (numConnected > 1 and edges.size() < numEdges)
+            {
+                Defs::VertexID u = generator() % numConnected, v = generator() % numConnected;
+
+                if (u != v)
+                    edges.push_back(EdgeSpec { u, v, weight(generator), weight(generator), weight(generator) });
+            }
+
+            return edges;
+        }
+
+        /**
+         * @return The graphs every engine is checked on: a connected one, one with
+         *         unreachable vertices (two components and isolated vertices), one where
+         *         most weights are zero and a single vertex
+         **/
+        inline std::vector<GraphCase> GraphCases()
+        {
+            std::vector<GraphCase> cases;
+
+            cases.push_back(GraphCase { "connected", 60, RandomEdges(60, 240, 1, 50, 1) });
+
+            // Vertices 0-29 and 30-49 are two components, 50-54 are isolated
+            GraphCase unreachable { "unreachable", 55, RandomEdges(30, 90, 1, 50, 2) };
+            for (auto &edge : RandomEdges(20, 50, 1, 50, 3))
+            {
+                edge.m_u += 30;
+                edge.m_v += 30;
+                unreachable.m_edges.push_back(edge);
+            }
+            cases.push_back(unreachable);
+
+            cases.push_back(GraphCase { "zero weights", 40, RandomEdges(40, 120, 0, 2, 4) });
+            cases.push_back(GraphCase { "single vertex", 1, {} });
+
+            return cases;
+        }
+
+        /**
+         * @return Distances from the source computed by Graph::Dijkstra, the reference of
+         *         every engine
+         **/
+        inline std::vector<std::size_t> ReferenceDistances(Graph &graph, Defs::VertexID source,
+                                                           Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME)
+        {
+            ShortestPathResult result = graph.Dijkstra(source, edgeInfo);
+
+            return std::vector<std::size_t>(result.m_distances.begin(), result.m_distances.end());
+        }
+
+        /**
+         * @return Cost of a path given by its vertices, taking the cheapest arc between
+         *         consecutive vertices. Infinity if two consecutive vertices are not adjacent
+         **/
+        inline std::size_t PathCost(const StaticGraph &graph, const Vector<std::size_t> &vertices,
+                                    Defs::EDGE_INFO edgeInfo = Defs::EDGE_INFO::TIME)
+        {
+            std::size_t cost = 0, cheapest;
+
+            for (std::size_t i = 1; i < vertices.Size(); i++)
+            {
+                cheapest = Defs::INFINITY_VALUE;
+
+                for (auto arc = graph.FirstArc(vertices[i - 1]); arc < graph.FirstArc(vertices[i - 1] + 1); arc++)
+                {
+                    if (graph.GetHead(arc) == vertices[i] and graph.GetWeight(arc, edgeInfo) < cheapest)
+                        cheapest = graph.GetWeight(arc, edgeInfo);
+                }
+
+                if (cheapest == Defs::INFINITY_VALUE)
+                    return Defs::INFINITY_VALUE;
+
+                cost += cheapest;
+            }
+
+            return cost;
+        }
+    }
+}
+
+#endif // TEST_GRAPHS_H_
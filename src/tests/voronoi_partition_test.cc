@@ -0,0 +1,116 @@
+/*
+* Filename: voronoi_partition_test.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "doctest.h"
+#include "test_graphs.h"
+#include "voronoi_partition.h"
+
+using namespace geom;
+
+namespace
+{
+    /**
+     * @brief Check a partition against one Graph::Dijkstra per facility: each vertex is
+     *        owned by one of its nearest facilities, the first listed if no tie goes through
+     *        arcs of weight 0
+     **/
+    void CheckPartition(Graph &graph, const VoronoiPartition &partition, const Vector<std::size_t> &facilities,
+                        bool firstOwner)
+    {
+        std::vector<std::vector<std::size_t>> reference;
+
+        for (std::size_t f = 0; f < facilities.Size(); f++)
+            reference.push_back(test::ReferenceDistances(graph, facilities[f]));
+
+        for (std::size_t v = 0; v < graph.GetNumVertices(); v++)
+        {
+            std::size_t nearest = Defs::INFINITY_VALUE;
+            Defs::VertexID first = VoronoiPartition::NO_OWNER;
+
+            for (std::size_t f = 0; f < facilities.Size(); f++)
+            {
+                if (reference[f][v] < nearest)
+                {
+                    nearest = reference[f][v];
+                    first = f;
+                }
+            }
+
+            REQUIRE(partition.GetDistance(v) == nearest);
+
+            if (nearest == Defs::INFINITY_VALUE)
+            {
+                CHECK(partition.GetOwner(v) == VoronoiPartition::NO_OWNER);
+            }
+            else
+            {
+                REQUIRE(partition.GetOwner(v) < facilities.Size());
+                CHECK(reference[partition.GetOwner(v)][v] == nearest);
+
+                if (firstOwner)
+                    CHECK(partition.GetOwner(v) == first);
+            }
+        }
+    }
+}
+
+TEST_CASE("VoronoiPartition matches a Dijkstra per facility")
+{
+    std::vector<test::GraphCase> cases = test::GraphCases();
+
+    // Weights larger than the number of vertices, which take the heap
+    cases.push_back(test::GraphCase { "large weights", 50, test::RandomEdges(50, 200, 1, 100000, 8) });
+
+    for (auto &graphCase : cases)
+    {
+        SUBCASE(graphCase.m_name.c_str())
+        {
+            auto graph = test::MakeGraph(graphCase.m_numVertices, graphCase.m_edges);
+            StaticGraph staticGraph(*graph);
+            VoronoiPartition partition(staticGraph);
+            bool zeroWeights = false;
+
+            for (auto &edge : graphCase.m_edges)
+                zeroWeights = zeroWeights or edge.m_time == 0;
+
+            CHECK(partition.UsesBuckets() == (graphCase.m_name != "large weights"));
+
+            // One facility, every vertex, every seventh one with the first listed twice
+            std::vector<Vector<std::size_t>> facilitySets(3);
+
+            facilitySets[0].PushBack(graphCase.m_numVertices - 1);
+
+            for (std::size_t v = 0; v < graphCase.m_numVertices; v++)
+                facilitySets[1].PushBack(v);
+
+            for (std::size_t v = 0; v < graphCase.m_numVertices; v += 7)
+                facilitySets[2].PushBack(v);
+            facilitySets[2].PushBack(0);
+
+            for (auto &facilities : facilitySets)
+            {
+                partition.Run(facilities);
+                CheckPartition(*graph, partition, facilities, not zeroWeights);
+            }
+        }
+    }
+}
+
+TEST_CASE("VoronoiPartition without facilities")
+{
+    auto graph = test::MakeGraph(3, { { 0, 1, 1, 1, 1 } });
+    StaticGraph staticGraph(*graph);
+    VoronoiPartition partition(staticGraph);
+    Vector<std::size_t> none;
+
+    partition.Run(none);
+
+    for (std::size_t v = 0; v < 3; v++)
+    {
+        CHECK(partition.GetOwner(v) == VoronoiPartition::NO_OWNER);
+        CHECK(partition.GetDistance(v) == Defs::INFINITY_VALUE);
+    }
+}
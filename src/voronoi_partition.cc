@@ -0,0 +1,153 @@
+/*
+* Filename: voronoi_partition.cc
+* Created on: October 19, 2026
+* Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+*/
+
+#include "voronoi_partition.h"
+
+namespace geom
+{
+    VoronoiPartition::VoronoiPartition(const StaticGraph &graph, Defs::EDGE_INFO edgeInfo)
+    {
+        this->m_graph = &graph;
+        this->m_edgeInfo = edgeInfo;
+
+        this->m_dist.Resize(graph.GetNumVertices());
+        this->m_owner.Resize(graph.GetNumVertices());
+        this->m_settled.Resize(graph.GetNumVertices());
+
+        // A queued distance is at most the largest weight ahead of the current one, so this
+        // many buckets never wrap onto a distance still in use
+        std::size_t maxWeight = 0;
+
+        for (std::size_t arc = 0; arc < graph.GetNumArcs(); arc++)
+            maxWeight = std::max<std::size_t>(maxWeight, graph.GetWeight(arc, edgeInfo));
+
+        // With more buckets than vertices, most buckets would hold a single vertex
+        if (maxWeight + 1 <= std::min(graph.GetNumVertices(), MAX_BUCKETS))
+            this->m_buckets.resize(maxWeight + 1);
+    }
+
+    VoronoiPartition::~VoronoiPartition() { }
+
+    void VoronoiPartition::Run(const Vector<std::size_t> &facilities)
+    {
+        for (std::size_t i = 0; i < this->m_graph->GetNumVertices(); i++)
+        {
+            this->m_dist[i] = Defs::INFINITY_VALUE;
+            this->m_owner[i] = NO_OWNER;
+            this->m_settled[i] = false;
+        }
+
+        // A vertex with several facilities keeps the first one
+        for (std::size_t f = 0; f < facilities.Size(); f++)
+        {
+            if (this->m_owner[facilities[f]] == NO_OWNER)
+            {
+                this->m_dist[facilities[f]] = 0;
+                this->m_owner[facilities[f]] = f;
+            }
+        }
+
+        if (this->UsesBuckets())
+            this->RunBuckets(facilities);
+        else
+            this->RunHeap(facilities);
+    }
+
+    void VoronoiPartition::RunBuckets(const Vector<std::size_t> &facilities)
+    {
+        const std::size_t numBuckets = this->m_buckets.size();
+
+        for (std::size_t f = 0; f < facilities.Size(); f++)
+        {
+            if (this->m_owner[facilities[f]] == f)
+                this->m_buckets[0].push_back(facilities[f]);
+        }
+
+        if (not this->m_buckets[0].empty())
+            this->m_bucketDists.Enqueue(0);
+
+        // Auxiliar variables to make code most legible
+        std::vector<Defs::VertexID>* bucket = nullptr;
+        Defs::VertexID u, v;
+        std::size_t dist, vDist;
+
+        // The non-empty buckets are visited in increasing distance, going around the circular
+        // array. The queued distances span less than a turn, so each bucket holds one of them
+        while (not this->m_bucketDists.IsEmpty())
+        {
+            dist = this->m_bucketDists.Dequeue();
+            bucket = &this->m_buckets[dist % numBuckets];
+
+            // Arcs of weight 0 add to the bucket being emptied
+            while (not bucket->empty())
+            {
+                u = bucket->back();
+                bucket->pop_back();
+
+                // Outdated entry, the vertex was settled or queued again with a smaller distance
+                if (this->m_settled[u] or this->m_dist[u] != dist)
+                    continue;
+
+                this->m_settled[u] = true;
+
+                for (Defs::EdgeID arc = this->m_graph->FirstArc(u); arc < this->m_graph->FirstArc(u + 1); arc++)
+                {
+                    v = this->m_graph->GetHead(arc);
+                    vDist = dist + this->m_graph->GetWeight(arc, this->m_edgeInfo);
+
+                    if (this->Improve(u, v, vDist))
+                    {
+                        // The bucket being emptied is not queued again
+                        if (this->m_buckets[vDist % numBuckets].empty() and vDist != dist)
+                            this->m_bucketDists.Enqueue(vDist);
+
+                        this->m_buckets[vDist % numBuckets].push_back(v);
+                    }
+                }
+            }
+        }
+    }
+
+    void VoronoiPartition::RunHeap(const Vector<std::size_t> &facilities)
+    {
+        for (std::size_t f = 0; f < facilities.Size(); f++)
+        {
+            if (this->m_owner[facilities[f]] == f)
+                this->m_queue.Enqueue(Entry(0, facilities[f]));
+        }
+
+        // Auxiliar variables to make code most legible
+        Entry entry;
+        Defs::VertexID u, v;
+        std::size_t vDist;
+
+        while (not this->m_queue.IsEmpty())
+        {
+            entry = this->m_queue.Dequeue();
+            u = entry.second;
+
+            // Outdated entry, the vertex was settled with a smaller distance
+            if (this->m_settled[u] or entry.first > this->m_dist[u])
+                continue;
+
+            this->m_settled[u] = true;
+
+            for (Defs::EdgeID arc = this->m_graph->FirstArc(u); arc < this->m_graph->FirstArc(u + 1); arc++)
+            {
+                v = this->m_graph->GetHead(arc);
+                vDist = entry.first + this->m_graph->GetWeight(arc, this->m_edgeInfo);
+
+                if (this->Improve(u, v, vDist))
+                    this->m_queue.Enqueue(Entry(vDist, v));
+            }
+        }
+    }
+
+    bool VoronoiPartition::UsesBuckets() const
+    {
+        return not this->m_buckets.empty();
+    }
+}